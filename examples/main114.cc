@@ -0,0 +1,120 @@
+// main114.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: basic usage; utility
+
+// This is a simple test program.
+// It illustrates how the settings and particle data of a Pythia object,
+// read from the XML files and then modified, can be written to a binary
+// snapshot file. A second object is constructed from the snapshot, which
+// avoids reading the XML files, and it is checked that the settings and
+// particle properties agree with those of the first object. Events are
+// then generated with the second object.
+
+#include "Pythia8/Pythia.h"
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Name of the snapshot file.
+  string fileName = "main114.snap";
+
+  // Generator, from the XML files. Process selection. LHC energy.
+  // Also change a few particle properties: the Z0 mass, no pi0 decays,
+  // and only t -> W+ b decays.
+  Pythia pythiaXML("../share/Pythia8/xmldoc", false);
+  pythiaXML.readString("Beams:eCM = 13000.");
+  pythiaXML.readString("HardQCD:all = on");
+  pythiaXML.readString("PhaseSpace:pTHatMin = 20.");
+  pythiaXML.readString("Next:numberCount = 0");
+  pythiaXML.readString("23:m0 = 91.0");
+  pythiaXML.readString("111:mayDecay = off");
+  pythiaXML.readString("6:oneChannel = 1 1. 0 24 5");
+
+  // Write the settings and particle data to a snapshot.
+  if (!pythiaXML.writeSnapshot(fileName)) return 1;
+
+  // Generator, from the snapshot.
+  Snapshot snapshot(fileName);
+  Pythia pythia(snapshot);
+  Settings& settings = pythia.settings;
+  ParticleData& pd   = pythia.particleData;
+
+  // Check the settings changed above, and a few unchanged ones.
+  int nBad = 0;
+  if (settings.parm("Beams:eCM") != 13000. || !settings.flag("HardQCD:all")
+    || settings.parm("PhaseSpace:pTHatMin") != 20.
+    || settings.mode("Next:numberCount") != 0) ++nBad;
+  if (settings.parm("StringZ:aLund")
+      != pythiaXML.settings.parm("StringZ:aLund")
+    || settings.mode("Tune:pp") != pythiaXML.settings.mode("Tune:pp")
+    || settings.flag("PartonLevel:MPI") != true) ++nBad;
+  cout << "\n Number of settings that differ after loading the snapshot: "
+       << nBad << endl;
+
+  // Check the particle properties changed above.
+  int nBadSet = 0;
+  if (pd.m0(23) != 91.0 || pd.mayDecay(111) || pd.name(-211) != "pi-")
+    ++nBadSet;
+  ParticleDataEntryPtr topPtr = pd.findParticle(6);
+  if (topPtr == nullptr || topPtr->sizeChannels() != 1
+    || topPtr->channel(0).product(0) != 24
+    || topPtr->channel(0).product(1) != 5) ++nBadSet;
+
+  // Check the properties of all particles against those from the XML files.
+  // The entry with code 0 is only a placeholder.
+  int nParticle = 0;
+  for (auto pdtEntry = pythiaXML.particleData.begin();
+    pdtEntry != pythiaXML.particleData.end(); ++pdtEntry) {
+    if (pdtEntry->first == 0) continue;
+    ++nParticle;
+    ParticleDataEntryPtr ptrXML = pdtEntry->second;
+    ParticleDataEntryPtr ptr    = pd.findParticle(pdtEntry->first);
+    if (ptr == nullptr) {++nBadSet; continue;}
+    if (ptr->name(-1) != ptrXML->name(-1) || ptr->m0() != ptrXML->m0()
+      || ptr->mWidth() != ptrXML->mWidth() || ptr->tau0() != ptrXML->tau0()
+      || ptr->chargeType() != ptrXML->chargeType()
+      || ptr->sizeChannels() != ptrXML->sizeChannels()) ++nBadSet;
+    else for (int i = 0; i < ptr->sizeChannels(); ++i)
+      if (ptr->channel(i).bRatio() != ptrXML->channel(i).bRatio()
+        || ptr->channel(i).multiplicity()
+        != ptrXML->channel(i).multiplicity()) ++nBadSet;
+  }
+  cout << " Number of particles that differ, out of " << nParticle << ": "
+       << nBadSet << endl;
+  nBad += nBadSet;
+
+  // Initialize the generator from the snapshot. Histogram.
+  if (!pythia.init()) return 1;
+  Hist nCharged("charged multiplicity", 100, -0.5, 399.5);
+  Hist nPi0("number of pi0 in the final state", 100, -0.5, 199.5);
+
+  // Begin event loop. Generate event. Skip if error.
+  for (int iEvent = 0; iEvent < 100; ++iEvent) {
+    if (!pythia.next()) continue;
+
+    // Count charged particles and undecayed pi0.
+    int nChg = 0, nPi0Now = 0;
+    for (int i = 0; i < pythia.event.size(); ++i)
+    if (pythia.event[i].isFinal()) {
+      if (pythia.event[i].isCharged()) ++nChg;
+      if (pythia.event[i].id() == 111) ++nPi0Now;
+    }
+    nCharged.fill( nChg );
+    nPi0.fill( nPi0Now );
+
+  // End of event loop. Statistics. Histograms.
+  }
+  pythia.stat();
+  cout << nCharged << nPi0;
+
+  // The pi0 should not have decayed.
+  if (nPi0.getEntries() == 0 || nPi0.getXMean() < 1.) ++nBad;
+
+  // Done.
+  return (nBad == 0) ? 0 : 1;
+}
@@ -0,0 +1,95 @@
+// main128.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: LHE file; utility
+
+// This is a benchmark of the reading of Les Houches Event Files with
+// many weights per event. A large file is first written, where the
+// events of wbj_lhef3.lhe are repeated with a long list of detailed
+// weights. It is then read back both with the streaming and with the
+// generic parsing of the LHEF Reader, which give the same results but
+// take very different times. It is checked that the two agree event
+// by event.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events and number of weights per event in the file.
+  int nEvent = 1000;
+  int nWgt   = 200;
+  string fileName = "main128.lhe";
+
+  // Read in the events of the example file.
+  Reader readerIn("wbj_lhef3.lhe");
+  if (!readerIn.isGood) return 1;
+  vector<HEPEUP> events;
+  while (readerIn.readEvent()) events.push_back(readerIn.hepeup);
+  if (events.empty()) return 1;
+
+  // Write them out repeatedly, with new detailed weights.
+  Rndm rndm(4711);
+  {
+    Writer writer(fileName);
+    writer.heprup = readerIn.heprup;
+    writer.init();
+    for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+      HEPEUP& eup = events[iEvent % events.size()];
+      eup.rwgtSave.clear();
+      for (int iWgt = 0; iWgt < nWgt; ++iWgt) {
+        LHAwgt wgt(eup.XWGTUP * (0.5 + rndm.flat()));
+        wgt.id = to_string(1001 + iWgt);
+        eup.rwgtSave.wgts[wgt.id] = wgt;
+      }
+      writer.writeEvent(&eup);
+    }
+    writer.list_end_tag();
+  }
+
+  // Read the file back with the generic and with the streaming parsing.
+  // Form a checksum of momenta and weights of each event to compare the
+  // two, outside the timed loops.
+  double timeMode[2];
+  vector<double> sumMode[2];
+  for (int iMode = 0; iMode < 2; ++iMode) {
+    sumMode[iMode].reserve(nEvent);
+    auto timeStart = std::chrono::steady_clock::now();
+    Reader reader(fileName);
+    reader.setStreamParsing(iMode == 1);
+    while (reader.readEvent()) {
+      const HEPEUP& eup = reader.hepeup;
+      double sum = 0.;
+      for (int i = 0; i < eup.NUP; ++i) sum += eup.PUP[i][3];
+      for (double wgt : reader.weights_detailed_vec) sum += wgt;
+      for (double wgt : eup.weights_compressed) sum += wgt;
+      sumMode[iMode].push_back(sum);
+    }
+    timeMode[iMode] = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - timeStart).count();
+  }
+
+  // Both parsings should read all events, with the same contents.
+  int nBad = 0;
+  for (int iMode = 0; iMode < 2; ++iMode)
+    if (int(sumMode[iMode].size()) != nEvent) ++nBad;
+  for (int iEvent = 0; iEvent < int(min(sumMode[0].size(),
+    sumMode[1].size())); ++iEvent)
+    if (sumMode[0][iEvent] != sumMode[1][iEvent]) ++nBad;
+
+  // Print the results.
+  cout << "\n Reading " << nEvent << " events with " << nWgt
+       << " weights each:\n" << fixed << setprecision(3)
+       << "   generic parsing:   " << setw(8) << timeMode[0] << " s\n"
+       << "   streaming parsing: " << setw(8) << timeMode[1] << " s\n"
+       << " Number of events read " << sumMode[0].size() << " and "
+       << sumMode[1].size() << ", of which " << nBad << " differ." << endl;
+
+  // Done.
+  return (nBad == 0) ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+// main129.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: basic usage; event record; output
+
+// This is a simple test program.
+// It illustrates how events can be written to a binary event file with
+// the EventFileWriter, and then read back with the EventFileReader.
+// The particles of the stored events are first inspected in place,
+// and then copied into the event record for a further analysis.
+
+#include "Pythia8/Pythia.h"
+using namespace Pythia8;
+
+//==========================================================================
+
+int main() {
+
+  // Number of events, and name of the event file.
+  int nEvent      = 1000;
+  string fileName = "main129.evt";
+
+  // Generator. Process selection. LHC initialization.
+  Pythia pythia;
+  pythia.readString("Beams:eCM = 13000.");
+  pythia.readString("HardQCD:all = on");
+  pythia.readString("PhaseSpace:pTHatMin = 20.");
+  pythia.readString("Next:numberCount = 0");
+  if (!pythia.init()) return 1;
+
+  // Multiplicity and summed energy of each event, for later comparison.
+  vector<int>    nChgGen;
+  vector<double> eSumGen;
+
+  // Begin event loop. Generate event. Skip if error.
+  EventFileWriter writer(fileName, false, &pythia.logger);
+  if (!writer.isOpen()) return 1;
+  for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+    if (!pythia.next()) continue;
+
+    // Save the event, and record its charged multiplicity and energy.
+    writer.write(pythia.event, pythia.info);
+    int    nChg = 0;
+    double eSum = 0.;
+    for (int i = 0; i < pythia.event.size(); ++i)
+    if (pythia.event[i].isFinal()) {
+      if (pythia.event[i].isCharged()) ++nChg;
+      eSum += pythia.event[i].e();
+    }
+    nChgGen.push_back(nChg);
+    eSumGen.push_back(eSum);
+
+  // End of event loop. Close the file.
+  }
+  writer.close();
+  pythia.stat();
+
+  // Reopen the file and check that all events were stored.
+  EventFileReader reader(fileName, &pythia.logger);
+  cout << "\n Number of events written " << writer.nEvents()
+       << " and read back " << reader.nEvents() << endl;
+  if (reader.nEvents() != long(nChgGen.size())) return 1;
+
+  // Loop over the stored events, inspecting the particles in place.
+  // ParticleView does not know about charge, so take it from the id.
+  int nBad = 0;
+  while (reader.next()) {
+    int    nChg = 0;
+    double eSum = 0.;
+    for (int i = 0; i < reader.size(); ++i)
+    if (reader[i].isFinal()) {
+      if (pythia.particleData.chargeType(reader[i].id()) != 0) ++nChg;
+      eSum += reader[i].e();
+    }
+    long iEvent = reader.iEvent();
+    if (nChg != nChgGen[iEvent] || eSum != eSumGen[iEvent]) ++nBad;
+  }
+  cout << " Number of events that differ from the generated ones: "
+       << nBad << endl;
+
+  // Book histograms.
+  Hist nCharged("charged particle multiplicity", 100, -0.5, 399.5);
+  Hist dndeta("dn/d(eta) for charged particles", 100, -10., 10.);
+  Hist pTHard("event scale, from the file", 100, 0., 200.);
+
+  // Copy every second event into the event record, in reverse order,
+  // and analyze it as if it had just been generated.
+  Event& event = pythia.event;
+  for (long iEvent = reader.nEvents() - 1; iEvent >= 0; iEvent -= 2) {
+    if (!reader.goTo(iEvent) || !reader.fill(event)) continue;
+    int nChg = 0;
+    for (int i = 0; i < event.size(); ++i)
+    if (event[i].isFinal() && event[i].isCharged()) {
+      ++nChg;
+      dndeta.fill( event[i].eta(), reader.weight() );
+    }
+    nCharged.fill( nChg, reader.weight() );
+    pTHard.fill( reader.scale(), reader.weight() );
+  }
+
+  // Print histograms.
+  cout << nCharged << dndeta << pTHard;
+
+  // Done.
+  return (nBad == 0) ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+// main165.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: merging; CKKW-L; utility
+
+// This is a benchmark of the cost of CKKW-L merging, i.e. of the
+// construction of the histories and of the trial showers. The events of
+// w_production_tree_2.lhe are showered first without and then with
+// pT-Lund merging, and the time and the number of heap allocations per
+// event are compared. The difference is the cost of the merging, and
+// running the program with different PYTHIA versions shows how this cost
+// changes, e.g. from the reuse of the trial-shower event records.
+// It is also checked that both runs read the same events, and that the
+// merging rejects some of them.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+#include <cstdlib>
+#include <new>
+using namespace Pythia8;
+
+//==========================================================================
+
+// Count all heap allocations made by the program.
+
+static atomic<long> nAllocations(0);
+
+void* operator new(size_t size) {
+  ++nAllocations;
+  if (void* ptr = std::malloc(size == 0 ? 1 : size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+
+//==========================================================================
+
+int main() {
+
+  // Maximum number of events, and the input file with W + 2 jets events.
+  int nEvent = 500;
+  string fileName = "w_production_tree_2.lhe";
+
+  // Shower the events without (iMode = 0) and with (iMode = 1) merging.
+  double timeMode[2], allocMode[2];
+  int nReadMode[2], nAcceptMode[2];
+  for (int iMode = 0; iMode < 2; ++iMode) {
+    Pythia pythia;
+    pythia.readString("Beams:frameType = 4");
+    pythia.readString("Beams:LHEF = " + fileName);
+    pythia.readString("HadronLevel:all = off");
+    pythia.readString("SpaceShower:rapidityOrder = off");
+    pythia.readString("Next:numberCount = 0");
+    pythia.readString("Print:quiet = on");
+    if (iMode == 1) {
+      pythia.readString("Merging:doPTLundMerging = on");
+      pythia.readString("Merging:TMS = 15");
+      pythia.readString("Merging:Process = pp>LEPTONS,NEUTRINOS");
+      pythia.readString("Merging:nJetMax = 2");
+    }
+    if (!pythia.init()) return 1;
+
+    // Generate the events and count time and allocations.
+    nReadMode[iMode] = nAcceptMode[iMode] = 0;
+    long nAllocStart = nAllocations;
+    auto timeStart = std::chrono::steady_clock::now();
+    for (int iEvent = 0; iEvent < nEvent; ++iEvent) {
+      if (!pythia.next()) {
+        if (pythia.info.atEndOfFile()) break;
+        ++nReadMode[iMode];
+        continue;
+      }
+      ++nReadMode[iMode];
+      if (pythia.info.weight() != 0.) ++nAcceptMode[iMode];
+    }
+    timeMode[iMode] = std::chrono::duration<double>(
+      std::chrono::steady_clock::now() - timeStart).count()
+      / max(1, nReadMode[iMode]);
+    allocMode[iMode] = double(nAllocations - nAllocStart)
+      / max(1, nReadMode[iMode]);
+  }
+
+  // Print the results.
+  cout << "\n Showering " << nReadMode[0] << " W + 2 jets events, per event:\n"
+       << fixed << setprecision(1)
+       << "                   time (ms)   allocations   accepted\n"
+       << "   no merging:  " << setw(12) << 1e3 * timeMode[0]
+       << setw(14) << allocMode[0] << setw(11) << nAcceptMode[0] << "\n"
+       << "   merging:     " << setw(12) << 1e3 * timeMode[1]
+       << setw(14) << allocMode[1] << setw(11) << nAcceptMode[1] << "\n"
+       << "   difference:  " << setw(12) << 1e3 * (timeMode[1] - timeMode[0])
+       << setw(14) << allocMode[1] - allocMode[0] << endl;
+
+  // Both runs should read the same events. Without merging all of them
+  // are kept, with merging some but not all should be.
+  int nBad = 0;
+  if (nReadMode[0] == 0 || nReadMode[1] != nReadMode[0]) ++nBad;
+  if (nAcceptMode[0] != nReadMode[0]) ++nBad;
+  if (nAcceptMode[1] == 0 || nAcceptMode[1] >= nReadMode[1]) ++nBad;
+  cout << " Number of failed checks: " << nBad << endl;
+
+  // Done.
+  return (nBad == 0) ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+// main283.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Keywords: utility; particle data
+
+// This program checks and times the lookup of particle properties by id.
+// Codes with |id| below 10000, i.e. quarks, leptons, gauge bosons and
+// ground-state hadrons, are found through a direct index, while other
+// codes, e.g. of excited hadrons and SUSY states, are searched for in the
+// map of all particles. All lookups are first checked against the entries
+// of the map, and then the average time of a lookup is measured for the
+// two kinds of codes.
+
+#include "Pythia8/Pythia.h"
+#include <chrono>
+using namespace Pythia8;
+
+//==========================================================================
+
+// Time a number of passes of mass lookups over a list of codes.
+// Return the average time per lookup, in nanoseconds.
+
+double timeLookups(ParticleData& pd, const vector<int>& ids, int nPass,
+  double& sum) {
+  auto timeStart = std::chrono::steady_clock::now();
+  for (int iPass = 0; iPass < nPass; ++iPass)
+    for (int id : ids) sum += pd.m0(id);
+  double time = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - timeStart).count();
+  return 1e9 * time / max(1., double(nPass) * ids.size());
+}
+
+//==========================================================================
+
+int main() {
+
+  // Number of passes over all codes in the timing.
+  int nPass = 2000;
+
+  // Generator, only used for its particle data table.
+  Pythia pythia("../share/Pythia8/xmldoc", false);
+  ParticleData& pd = pythia.particleData;
+
+  // Check that every particle and antiparticle in the map is found, with
+  // the properties of its entry, and collect their codes. The entry with
+  // code 0 is only a placeholder.
+  vector<int> idIndexed, idMapped;
+  int nBad = 0;
+  for (auto pdtEntry = pd.begin(); pdtEntry != pd.end(); ++pdtEntry) {
+    int id = pdtEntry->first;
+    if (id == 0) continue;
+    ParticleDataEntryPtr ptr = pdtEntry->second;
+    vector<int>& ids = (id < 10000) ? idIndexed : idMapped;
+    ids.push_back(id);
+    if (!pd.isParticle(id) || pd.findParticle(id) != ptr
+      || pd.m0(id) != ptr->m0() || pd.name(id) != ptr->name(1)) ++nBad;
+    if (pd.isParticle(-id) != ptr->hasAnti()) ++nBad;
+    if (ptr->hasAnti()) {
+      ids.push_back(-id);
+      if (pd.findParticle(-id) != ptr || pd.name(-id) != ptr->name(-1)
+        || pd.chargeType(-id) != -ptr->chargeType()) ++nBad;
+    }
+  }
+
+  // Codes that do not exist should not be found.
+  for (int id : {0, 9, 10, 9999, -9999, 10000, 99999999, -99999999})
+    if (pd.isParticle(id) != (pd.findParticle(id) != nullptr)) ++nBad;
+
+  // Check that particles added or replaced later are also found.
+  pd.addParticle(9000, "test", "testbar", 1, 3, 0, 100.);
+  pd.addParticle(9000009, "test2", 1, 0, 0, 200.);
+  if (pd.m0(9000) != 100. || pd.chargeType(-9000) != -3
+    || pd.m0(9000009) != 200. || pd.isParticle(-9000009)) ++nBad;
+  pd.m0(9000, 150.);
+  if (pd.m0(-9000) != 150.) ++nBad;
+  pd.addParticle(9000, "test3", 1, 0, 0, 120.);
+  if (pd.m0(9000) != 120. || pd.name(9000) != "test3"
+    || pd.isParticle(-9000)) ++nBad;
+
+  // Time the lookups of the two kinds of codes.
+  double sum = 0.;
+  double timeIndexed = timeLookups(pd, idIndexed, nPass, sum);
+  double timeMapped  = timeLookups(pd, idMapped, nPass, sum);
+
+  // Print the results. The sum is printed so the loops are not removed.
+  cout << "\n Checked " << idIndexed.size() + idMapped.size()
+       << " particle codes, of which " << nBad << " failed.\n"
+       << fixed << setprecision(2)
+       << " Average time per mass lookup:\n"
+       << "   |id| < 10000, " << setw(5) << idIndexed.size()
+       << " codes, direct index:  " << setw(7) << timeIndexed << " ns\n"
+       << "   |id| >= 10000, " << setw(4) << idMapped.size()
+       << " codes, map search:    " << setw(7) << timeMapped << " ns\n"
+       << " (Sum of masses " << scientific << sum << ".)" << endl;
+
+  // Done.
+  return (nBad == 0) ? 0 : 1;
+}
@@ -4,6 +4,7 @@
 // Please respect the MCnet Guidelines, see GUIDELINES for details.
 
 // Header file for the Sphericity, Thrust, ClusterJet and CellJet classes.
+// FinalStateArrays: final-state particles stored as contiguous arrays.
 // Sphericity: sphericity analysis of the event.
 // Thrust: thrust analysis of the event.
 // ClusterJet: clustering jet finder.
@@ -21,6 +22,69 @@ namespace Pythia8 {
 
 //==========================================================================
 
+// FinalStateArrays class.
+// This class stores the final-state particles of an event as a set of
+// contiguous arrays, one per property. It is filled once per event and
+// can then be handed to any number of the analysis classes below, which
+// thereby avoid repeated passes over the full Particle objects.
+
+class FinalStateArrays {
+
+public:
+
+  // Constructors.
+  FinalStateArrays() {}
+  FinalStateArrays(const Event& event) {fill(event);}
+
+  // Extract the final-state particles of an event. Reuses the storage.
+  void fill(const Event& event);
+
+  // Number of stored particles.
+  int size() const {return idSave.size();}
+
+  // Contiguous arrays of the particle properties.
+  const vector<double>& px()      const {return pxSave;}
+  const vector<double>& py()      const {return pySave;}
+  const vector<double>& pz()      const {return pzSave;}
+  const vector<double>& e()       const {return eSave;}
+  const vector<double>& m()       const {return mSave;}
+  const vector<double>& charge()  const {return chargeSave;}
+  const vector<int>&    id()      const {return idSave;}
+  const vector<int>&    status()  const {return statusSave;}
+  const vector<char>&   visible() const {return visibleSave;}
+
+  // Position of each particle in the original event record.
+  const vector<int>&    index()   const {return indexSave;}
+
+  // Four-momentum and derived kinematics of particle i.
+  Vec4   p(int i)   const {return Vec4( pxSave[i], pySave[i], pzSave[i],
+                                        eSave[i]);}
+  double pT(int i)  const {return sqrt(pxSave[i] * pxSave[i]
+                                     + pySave[i] * pySave[i]);}
+  double phi(int i) const {return atan2(pySave[i], pxSave[i]);}
+  double eta(int i) const;
+
+  // Selection option of the analysis classes for particle i, as a weight
+  // 1 if kept and 0 if not: 1 = all, 2 = visible only, > 2 = charged only.
+  // Lets loops over the arrays apply the selection without branching.
+  double keep(int selectIn, int i) const {
+    return (selectIn > 2) ? double(chargeSave[i] != 0.)
+      : (selectIn == 2) ? double(visibleSave[i] != 0) : 1.;}
+
+private:
+
+  // Constants: could only be changed in the code itself.
+  static const double TINY;
+
+  // The stored arrays.
+  vector<double> pxSave, pySave, pzSave, eSave, mSave, chargeSave;
+  vector<int>    idSave, statusSave, indexSave;
+  vector<char>   visibleSave;
+
+};
+
+//==========================================================================
+
 // Sphericity class.
 // This class performs (optionally modified) sphericity analysis on an event.
 
@@ -35,8 +99,9 @@ public:
     if (abs(power - 2.) < 0.01) powerInt = 2;
     powerMod = 0.5 * power - 1.;}
 
-  // Analyze event.
+  // Analyze event, or its final state stored as arrays.
   bool analyze(const Event& event);
+  bool analyze(const FinalStateArrays& fs);
 
   // Return info on results of analysis.
   double sphericity()      const {return 1.5 * (eVal2 + eVal3);}
@@ -70,6 +135,9 @@ private:
   // Error statistics;
   int    nFew;
 
+  // Find eigenvalues and eigenvectors of the summed momentum tensor.
+  bool diagonalize(double tt[4][4], double denom, int nStudy);
+
 };
 
 //==========================================================================
@@ -85,8 +153,9 @@ public:
   Thrust(int selectIn = 2) : select(selectIn), eVal1(), eVal2(), eVal3(),
     nFew(0) {}
 
-  // Analyze event.
+  // Analyze event, or its final state stored as arrays.
   bool analyze(const Event& event);
+  bool analyze(const FinalStateArrays& fs);
 
   // Return info on results of analysis.
   double thrust()       const {return eVal1;}
@@ -118,6 +187,9 @@ private:
   // Error statistics;
   int    nFew;
 
+  // Find the thrust, major and minor axes from the selected momenta.
+  bool findAxes(vector<Vec4>& pOrder, const Vec4& pSum);
+
 };
 
 //==========================================================================
@@ -192,9 +264,11 @@ public:
       if (firstChar == 'D') measure = 3;
     }
 
-  // Analyze event.
+  // Analyze event, or its final state stored as arrays.
   bool analyze(const Event& event, double yScaleIn, double pTscaleIn,
     int nJetMinIn = 1, int nJetMaxIn = 0);
+  bool analyze(const FinalStateArrays& fs, double yScaleIn,
+    double pTscaleIn, int nJetMinIn = 1, int nJetMaxIn = 0);
 
   // Return info on jets produced.
   int  size()      const {return jets.size();}
@@ -239,6 +313,7 @@ private:
   int    nFew;
 
   // Member functions for some operations (for clarity).
+  bool cluster(const Vec4& pSum);
   void precluster();
   void reassign();
 
@@ -317,9 +392,11 @@ public:
     threshold(thresholdIn), eTjetMin(), coneRadius(), eTseed(), nFew(0),
     rndmPtr(rndmPtrIn) { }
 
-  // Analyze event.
+  // Analyze event, or its final state stored as arrays.
   bool analyze(const Event& event, double eTjetMinIn = 20.,
     double coneRadiusIn = 0.7, double eTseedIn = 1.5);
+  bool analyze(const FinalStateArrays& fs, double eTjetMinIn = 20.,
+    double coneRadiusIn = 0.7, double eTseedIn = 1.5);
 
   // Return info on results of analysis.
   int    size()              const {return jets.size();}
@@ -361,6 +438,11 @@ private:
   // Pointer to the random number generator (needed for energy smearing).
   Rndm* rndmPtr;
 
+  // Book a particle in the cells, and find jets from the filled cells.
+  void addToCell(vector<SingleCell>& cells, double etaNow, double phiNow,
+    double pTnow);
+  bool findJets(vector<SingleCell>& cells);
+
 };
 
 //==========================================================================
@@ -447,8 +529,16 @@ public:
     while (clSize > 0) doStep();
     return true; }
 
+  // Analyze the final state stored as arrays. Cannot use a SlowJetHook.
+  bool analyze(const FinalStateArrays& fs) {
+    if ( !setup(fs) ) return false;
+    if (useFJcore) return clusterFJ();
+    while (clSize > 0) doStep();
+    return true; }
+
   // Set up list of particles to analyze, and initial distances.
   bool setup(const Event& event);
+  bool setup(const FinalStateArrays& fs);
 
   // Do one recombination step, possibly giving a jet.
   virtual bool doStep();
@@ -540,10 +630,24 @@ protected:
   vector<double> diB;
   vector<double> dij;
 
+  // Nearest neighbour of each cluster i among diB[i] and dij[i][j < i],
+  // with jRowMin = -1 for the beam. Kept up to date by each step.
+  vector<double> dRowMin;
+  vector<int>    jRowMin;
+
   // Other intermediate variables.
   int    origSize, clSize, clLast, jtSize, iMin, jMin;
   double dPhi, dijTemp, dMin;
 
+  // Store a particle as a new cluster, and set up initial distances.
+  void addCluster(const Vec4& pTemp, double mTemp, int iEvent);
+  bool setupDistances();
+
+  // Find the nearest neighbour of cluster i from scratch, or update it
+  // after the distance to cluster j < i has changed.
+  void findRowMin(int i);
+  void updateRowMin(int i, int j);
+
   // Find next cluster pair to join.
   virtual void findNext();
 
@@ -361,6 +361,11 @@ public:
   // generates a random number uniformly distributed between 0 and 1.
   virtual double flat() {return 1;}
 
+  // Fill a buffer with n random numbers. Can be overridden by a derived
+  // class that is able to generate many numbers at once.
+  virtual void flatBlock(double* buffer, int n) {
+    for (int i = 0; i < n; ++i) buffer[i] = flat();}
+
 };
 
 //==========================================================================
@@ -373,6 +378,14 @@ struct RndmState {
   long   sequence{0};
   double u[97]{}, c{}, cd{}, cm{};
 
+  // For the counter-based engine: the current and next event number,
+  // the number of blocks used in the current event, and the numbers
+  // left over from the current block.
+  bool   counterBased{false};
+  long   event{0}, eventNext{0}, block{0};
+  int    iBuffer{2};
+  double buffer[2]{};
+
   // Test whether two random states would generate the same random sequence.
   bool operator==(const RndmState& other) const;
 };
@@ -381,25 +394,52 @@ struct RndmState {
 
 // Rndm class.
 // This class handles random number generation according to the
-// Marsaglia-Zaman-Tsang algorithm.
+// Marsaglia-Zaman-Tsang algorithm, or optionally the counter-based
+// Philox4x32-10 one.
 
 class Rndm {
 
 public:
 
   // Constructors.
-  Rndm() : initRndm(false), stateSave(), useExternalRndm(false) { }
-  Rndm(int seedIn) : initRndm(false), stateSave(), useExternalRndm(false) {
-    init(seedIn);}
+  Rndm() : initRndm(false), stateSave(), useExternalRndm(false),
+    bufferExternalRndm(false), iFlat(0), nFlat(0) { }
+  Rndm(int seedIn) : initRndm(false), stateSave(), useExternalRndm(false),
+    bufferExternalRndm(false), iFlat(0), nFlat(0) {init(seedIn);}
 
   // Possibility to pass in pointer for external random number generation.
   bool rndmEnginePtr( RndmEnginePtr rndmEngPtrIn);
 
+  // Let an external generator fill a buffer of numbers in advance, rather
+  // than be called once for each number. Faster, but the generator is
+  // then no longer in step with the numbers actually used. The internal
+  // engines are not affected.
+  void bufferExternal(bool bufferIn) {
+    if (useExternalRndm && bufferIn != bufferExternalRndm) clearBuffer();
+    bufferExternalRndm = bufferIn;}
+
   // Initialize, normally at construction or in first call.
   void init(int seedIn = 0) ;
 
-  // Generate next random number uniformly between 0 and 1.
-  double flat() ;
+  // Initialize the counter-based engine instead. Then the random numbers
+  // of an event only depend on the seed and on the event number.
+  void initCounter(int seedIn = 0);
+
+  // Check whether the counter-based engine is used.
+  bool isCounterBased() const {return stateSave.counterBased;}
+
+  // Counter-based engine: start the random sequence of the next event,
+  // or set the number of the next event. Does nothing otherwise.
+  void nextEvent();
+  void setNextEvent(long iEventIn) {stateSave.eventNext = iEventIn;}
+
+  // Generate next random number uniformly between 0 and 1. The numbers
+  // are taken from a buffer that is refilled a block at a time.
+  double flat() {
+    return (iFlat < nFlat) ? flatSave[iFlat++] : flatRefill();}
+
+  // Fill a buffer with n random numbers, the same as n calls to flat().
+  void flatBlock(double* buffer, int n);
 
   // Generate random numbers according to exp(-x).
   double exp() ;
@@ -427,13 +467,17 @@ public:
   // Randomly shuffle a vector, standard Fisher-Yates algorithm.
   template<typename T> void shuffle(vector<T>& vec);
 
+  // Draw a seed, in the allowed range of init, for another generator.
+  int newSeed() {return 1 + int(flat() * 899999999.);}
+
   // Save or read current state to or from a binary file.
   bool dumpState(string fileName);
   bool readState(string fileName);
 
   // Get or set the state of the random number generator.
-  RndmState getState() const {return stateSave;}
-  void setState(const RndmState& state) {stateSave = state;}
+  RndmState getState() const;
+  void setState(const RndmState& state) {stateSave = state; initRndm = true;
+    nFlat = iFlat = 0;}
 
   // The default seed, i.e. the Marsaglia-Zaman random number sequence.
   static constexpr int DEFAULTSEED = 19780503;
@@ -461,9 +505,38 @@ private:
   RndmState stateSave;
 
   // Pointer for external random number generation.
-  bool   useExternalRndm;
+  bool   useExternalRndm, bufferExternalRndm;
   RndmEnginePtr rndmEngPtr{};
 
+  // Buffer of random numbers, the next one to use and the number filled,
+  // and the state before the buffer was filled. The sequence number of
+  // the saved state is that of the first number in the buffer.
+  static constexpr int NFLATBUFFER = 128;
+  double    flatSave[NFLATBUFFER];
+  int       iFlat, nFlat;
+  RndmState stateFlat;
+
+  // Marsaglia-Zaman-Tsang steps that can be taken together, given by the
+  // lags of the algorithm, with the carry offsets (k + 1) * cd modulo cm
+  // for each step, and the cd and cm values they were calculated for.
+  static constexpr int NMZBLOCK = 33;
+  double    carrySave[NMZBLOCK]{}, cdCarry{}, cmCarry{};
+
+  // Constants: could only be changed for a different algorithm.
+  static const uint32_t PHILOXM0, PHILOXM1, PHILOXW0, PHILOXW1;
+  static const double   TWOM52;
+
+  // Refill the buffer and return its first number. Discard the buffer.
+  double flatRefill();
+  void fillBuffer();
+  void clearBuffer() {stateSave.sequence += iFlat; nFlat = iFlat = 0;}
+
+  // Generate a single random number from a given state, internal engines.
+  static double flatNext(RndmState& state);
+
+  // Counter-based engine: generate the two random numbers of a block.
+  static void philox(int seed, long event, long block, double* out);
+
 };
 
 //==========================================================================
@@ -55,10 +55,19 @@ public:
     if ( photonFluxBIn ) pdfGamFluxBPtr = photonFluxBIn;
     return true;}
 
+  // Check whether PDFs or photon fluxes have been passed in. Their shape
+  // is not known from the settings, so initialization data cannot be reused.
+  bool hasUserPDFs() const {return userPDFs || pdfGamFluxAPtr
+    || pdfGamFluxBPtr;}
+
   // Possibility to pass in pointer to external LHA-interfaced generator.
   bool setLHAupPtr( LHAupPtr lhaUpPtrIn) {lhaUpPtr = lhaUpPtrIn;
     useNewLHA = false; return true;}
 
+  // Possibility to take Les Houches Event File input from a dispatcher.
+  bool setLHEFDispatcherPtr( LHEFDispatcherPtr lhefDispatcherPtrIn) {
+    lhefDispatcherPtr = lhefDispatcherPtrIn; return true;}
+
   // For a given particle id, get a particle that represents its properties,
   // i.e. a particle with the same PDF shape and parameters.
   int represent(int idIn) const;
@@ -126,6 +135,7 @@ public:
   Vec4   pAinit = {}, pBinit = {}, pAnow = {}, pBnow = {};
   RotBstMatrix MfromCM = {}, MtoCM = {};
   LHAupPtr lhaUpPtr = {};
+  LHEFDispatcherPtr lhefDispatcherPtr = {};
 
   // The two incoming beams.
   BeamParticle   beamA = {};
@@ -178,6 +188,9 @@ private:
          pdfGamFluxAPtr = {}, pdfGamFluxBPtr = {}, pdfVMDAPtr = {},
          pdfVMDBPtr = {};
 
+  // Whether the beam PDFs have been passed in by the user.
+  bool userPDFs = {};
+
   // Array of PDFs to be used when idA can be changed between events.
   vector<PDFPtr> pdfASavePtrs = {};
 
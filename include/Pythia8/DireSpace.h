@@ -530,6 +530,11 @@ private:
   bool  usePDFalphas, usePDFmasses, useSummedPDF,  usePDF, useSystems,
         useGlobalMapIF, forceMassiveMap, useMassiveBeams, suppressLargeMECs;
 
+  // Handles to the PDF set and to the limit on the final-state
+  // multiplicity, which may be changed between events.
+  const Word* pSetPtr{};
+  const Mode* nFinalMaxPtr{};
+
   unordered_map<int,double> pT2cutSave;
   double pT2cut(int id) {
     if (pT2cutSave.find(id) != pT2cutSave.end()) return pT2cutSave[id];
@@ -753,8 +758,7 @@ private:
     BeamParticle& beam = ( particleDataPtr->isHadron(beamAPtr->id()) )
                        ? *beamAPtr : *beamBPtr;
     bool usePDFmass = usePDFmasses
-      && (toLower(settingsPtr->word("PDF:pSet")).find("lhapdf")
-         != string::npos);
+      && (toLower(pSetPtr->valNow).find("lhapdf") != string::npos);
     double mRet = 0.;
     // Parton masses.
     if ( particleDataPtr->colType(id) != 0) {
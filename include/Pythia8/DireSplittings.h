@@ -90,6 +90,10 @@ public:
   Info* infoPtr;
   DireInfo* direInfoPtr;
 
+  // Handles to the shower cut-offs, which are read in each kernel call.
+  const Parm* pTminFSRPtr{};
+  const Parm* pTminISRPtr{};
+
   // Some short-cuts and string hashes to help avoid string comparisons.
   bool is_qcd, is_qed, is_ewk, is_fsr, is_isr, is_dire;
   ulong nameHash;
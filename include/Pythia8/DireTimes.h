@@ -546,6 +546,11 @@ private:
   bool usePDFalphas, usePDFmasses, useSummedPDF, usePDF, useSystems,
        useMassiveBeams, suppressLargeMECs;
 
+  // Handles to the PDF set and to the limit on the final-state
+  // multiplicity, which may be changed between events.
+  const Word* pSetPtr{};
+  const Mode* nFinalMaxPtr{};
+
   double pTchgQCut, pT2chgQCut, pTchgLCut, pT2chgLCut;
 
   unordered_map<int,double> pT2cutSave;
@@ -735,8 +740,7 @@ private:
               ? beamBPtr : nullptr;
     }
     bool usePDFmass = usePDFmasses
-      && (toLower(settingsPtr->word("PDF:pSet")).find("lhapdf")
-         != string::npos);
+      && (toLower(pSetPtr->valNow).find("lhapdf") != string::npos);
     double mRet = 0.;
     // Parton masses.
     if ( particleDataPtr->colType(id) != 0) {
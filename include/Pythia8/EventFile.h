@@ -0,0 +1,243 @@
+// EventFile.h is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// This file contains classes to write and read complete events in a
+// compact binary format.
+// ParticleView: read-only access to a particle stored in the file.
+// EventFileWriter: writes events, with their weights, to a file.
+// EventFileReader: maps a file into memory and reads events from it.
+
+#ifndef Pythia8_EventFile_H
+#define Pythia8_EventFile_H
+
+#include "Pythia8/Basics.h"
+#include "Pythia8/Event.h"
+#include "Pythia8/Info.h"
+#include "Pythia8/Logger.h"
+#include "Pythia8/PythiaStdlib.h"
+#include <cstdint>
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// Fixed-size records as stored in the file. All records are a multiple
+// of eight bytes long, so that they stay aligned in a mapped file.
+
+struct EventFileParticle {
+  int32_t id, status, mother1, mother2, daughter1, daughter2, col, acol,
+          hasVertex, unused;
+  double  px, py, pz, e, m, scale, pol, xProd, yProd, zProd, tProd, tau;
+};
+
+struct EventFileJunction {
+  int32_t remains, kind, col[3], endCol[3], status[3], unused;
+};
+
+//==========================================================================
+
+// The ParticleView class gives access to the properties of a particle
+// directly from the file contents, without creating a Particle object.
+
+class ParticleView {
+
+public:
+
+  // Constructor.
+  ParticleView(const EventFileParticle* recordPtrIn = nullptr)
+    : recordPtr(recordPtrIn) {}
+
+  // Basic properties, as stored.
+  int    id()        const {return recordPtr->id;}
+  int    status()    const {return recordPtr->status;}
+  int    mother1()   const {return recordPtr->mother1;}
+  int    mother2()   const {return recordPtr->mother2;}
+  int    daughter1() const {return recordPtr->daughter1;}
+  int    daughter2() const {return recordPtr->daughter2;}
+  int    col()       const {return recordPtr->col;}
+  int    acol()      const {return recordPtr->acol;}
+  double px()        const {return recordPtr->px;}
+  double py()        const {return recordPtr->py;}
+  double pz()        const {return recordPtr->pz;}
+  double e()         const {return recordPtr->e;}
+  double m()         const {return recordPtr->m;}
+  double scale()     const {return recordPtr->scale;}
+  double pol()       const {return recordPtr->pol;}
+  bool   hasVertex() const {return recordPtr->hasVertex != 0;}
+  double xProd()     const {return recordPtr->xProd;}
+  double yProd()     const {return recordPtr->yProd;}
+  double zProd()     const {return recordPtr->zProd;}
+  double tProd()     const {return recordPtr->tProd;}
+  double tau()       const {return recordPtr->tau;}
+
+  // A few derived quantities.
+  Vec4   p()         const {return Vec4( recordPtr->px, recordPtr->py,
+                                         recordPtr->pz, recordPtr->e);}
+  Vec4   vProd()     const {return Vec4( recordPtr->xProd, recordPtr->yProd,
+                                         recordPtr->zProd, recordPtr->tProd);}
+  int    idAbs()     const {return abs(recordPtr->id);}
+  bool   isFinal()   const {return recordPtr->status > 0;}
+  double pT()        const {return sqrt(pow2(recordPtr->px)
+                                      + pow2(recordPtr->py));}
+
+  // Create a full Particle object from the stored information.
+  Particle particle() const;
+
+private:
+
+  // Pointer to the record in the file.
+  const EventFileParticle* recordPtr;
+
+};
+
+//==========================================================================
+
+// The EventFileWriter class writes events to a binary file, one record
+// per event. Writing is thread-safe, so it can be used directly from
+// the callbacks of PythiaParallel.
+
+class EventFileWriter {
+
+public:
+
+  // Constructors. Compression requires the library to be built with zlib.
+  EventFileWriter(Logger* loggerPtrIn = nullptr) : loggerPtr(loggerPtrIn),
+    osPtr(nullptr), headerDone(false), nEventsSave(0) {}
+  EventFileWriter(string fileName, bool compress = false,
+    Logger* loggerPtrIn = nullptr) : loggerPtr(loggerPtrIn), osPtr(nullptr),
+    headerDone(false), nEventsSave(0) {open(fileName, compress);}
+
+  // Destructor. Closes the file.
+  ~EventFileWriter() {close();}
+
+  // Open a new file. Any previous file is closed.
+  bool open(string fileName, bool compress = false);
+
+  // Write an event, with its weights. The weight names are taken from
+  // the Info object passed with the first event.
+  bool write(const Event& event, const Info& info);
+  bool write(const Event& event, const vector<double>& weights = {},
+    const vector<string>& weightNames = {});
+
+  // Close the file.
+  void close();
+
+  // Check whether file is open, and number of events written.
+  bool isOpen() const {return osPtr != nullptr;}
+  long nEvents() const {return nEventsSave;}
+
+private:
+
+  // Pointer to logger for error messages, if any.
+  Logger* loggerPtr;
+
+  // The output stream, plain or compressed.
+  ostream* osPtr;
+
+  // Lock for thread-safe writing.
+  mutex writeMutex;
+
+  // Whether the file header has been written, and the number of events.
+  bool headerDone;
+  long nEventsSave;
+
+  // Write the file header, including the weight names.
+  void writeHeader(const vector<string>& weightNames);
+
+};
+
+//==========================================================================
+
+// The EventFileReader class maps a binary event file into memory and
+// gives access to one event at a time. The particles can either be
+// inspected in place through ParticleView objects, or copied into an
+// Event. A compressed file is instead decompressed into memory.
+
+class EventFileReader {
+
+public:
+
+  // Constructors.
+  EventFileReader(Logger* loggerPtrIn = nullptr) : loggerPtr(loggerPtrIn),
+    dataPtr(nullptr), dataSize(0), mapped(false), iEventNow(-1),
+    recordPtr(nullptr) {}
+  EventFileReader(string fileName, Logger* loggerPtrIn = nullptr)
+    : loggerPtr(loggerPtrIn), dataPtr(nullptr), dataSize(0), mapped(false),
+    iEventNow(-1), recordPtr(nullptr) {open(fileName);}
+
+  // Destructor. Releases the file.
+  ~EventFileReader() {close();}
+
+  // The mapped file, or the buffer the data points into, cannot be copied.
+  EventFileReader(const EventFileReader&) = delete;
+  EventFileReader& operator=(const EventFileReader&) = delete;
+
+  // Open a file and index the events in it. Release the file.
+  bool open(string fileName);
+  void close();
+
+  // Number of events in the file, and the index of the current one.
+  long nEvents() const {return offsets.size();}
+  long iEvent() const {return iEventNow;}
+
+  // Move to the next event, or to a given one. Start over.
+  bool next() {return goTo(iEventNow + 1);}
+  bool goTo(long iEventIn);
+  void rewind() {iEventNow = -1; recordPtr = nullptr;}
+
+  // Properties of the current event.
+  int    size() const;
+  int    sizeJunction() const;
+  double scale() const;
+  double scaleSecond() const;
+
+  // Access to the particles of the current event without copying.
+  ParticleView operator[](int i) const {return ParticleView(particles() + i);}
+
+  // Junctions of the current event.
+  Junction junction(int i) const;
+
+  // Weights of the current event, and their names.
+  int    nWeights() const;
+  double weight(int i = 0) const;
+  const vector<string>& weightNames() const {return weightNamesSave;}
+
+  // Copy the current event into an Event object.
+  bool fill(Event& event) const;
+
+private:
+
+  // Pointer to logger for error messages, if any.
+  Logger* loggerPtr;
+
+  // The file contents, mapped or read into memory.
+  const char*  dataPtr;
+  size_t       dataSize;
+  bool         mapped;
+  vector<char> buffer;
+
+  // Weight names from the file header.
+  vector<string> weightNamesSave;
+
+  // Start of each event record, and the current event.
+  vector<size_t> offsets;
+  long         iEventNow;
+  const char*  recordPtr;
+
+  // Locate the parts of the current event record.
+  const double* weights() const;
+  const EventFileParticle* particles() const;
+  const EventFileJunction* junctions() const;
+
+  // Read the file header and index the event records.
+  bool readIndex();
+
+};
+
+//==========================================================================
+
+} // end namespace Pythia8
+
+#endif // Pythia8_EventFile_H
@@ -111,6 +111,12 @@ public:
   // Initialise parameters when using close packing.
   virtual void init(double kappaRatio, double strangeFac, double probQQmod);
 
+  // Set the basic flavour and pT width parameters directly, without the
+  // settings database, e.g. for rope hadronization.
+  virtual void setEffectiveParameters(double probStoUDIn,
+    double probSQtoQQIn, double probQQ1toQQ0In, double probQQtoQIn,
+    double sigmaIn);
+
   // Pick a light d, u or s quark according to fixed ratios.
   int pickLightQ() { double rndmFlav = probQandS * rndmPtr->flat();
     if (rndmFlav < 1.) return 1;
@@ -211,6 +217,10 @@ protected:
   // Initialise derived parameters.
   virtual void initDerived();
 
+  // Save the current basic parameters as the "vacuum" ones used by the
+  // close-packing init(...), together with the diquark weight alphaQQ.
+  void saveVacuumParameters();
+
   // Constants: could only be changed in the code itself.
   static const int    mesonMultipletCode[6];
   static const double baryonCGOct[6], baryonCGDec[6];
@@ -278,6 +288,12 @@ public:
   // Initialize data members.
   virtual void init();
 
+  // Set the Lund a and b parameters directly, without the settings
+  // database, e.g. for rope hadronization.
+  virtual void setEffectiveParameters(double aLundIn, double bLundIn,
+    double aExtraDiquarkIn) {aLund = aLundIn; bLund = bLundIn;
+    aExtraDiquark = aExtraDiquarkIn;}
+
   // Fragmentation function: top-level to determine parameters.
   virtual double zFrag( int idOld, int idNew = 0, double mT2 = 1.);
 
@@ -335,6 +351,12 @@ public:
   // Initialize data members.
   virtual void init();
 
+  // Set the pT width directly, without the settings database,
+  // e.g. for rope hadronization.
+  virtual void setEffectiveParameters(double sigmaIn) {
+    sigmaQ    = sigmaIn / sqrt(2.);
+    sigma2Had = 2. * pow2( max( SIGMAMIN, sigmaIn) );}
+
   // General function, return px and py as a pair in the same call
   // in either model.
   pair<double, double>  pxy(int idIn, double kappaRatio = 0.0) {
@@ -298,7 +298,8 @@ class HardCoreModel : public NucleusModel {
 public:
 
   // Default constructor.
-  HardCoreModel() : useHardCore(), gaussHardCore(), hardCoreRadius(0.9) {}
+  HardCoreModel() : useHardCore(), gaussHardCore(), hardCoreRadius(0.9),
+    nPool(0), nCellSide(0), cellSize(0.0), cellMin(0.0) {}
 
   // Virtual destructor.
   virtual ~HardCoreModel() {}
@@ -313,8 +314,29 @@ public:
     if (gaussHardCore) return hardCoreRadius * abs(rndmPtr->gauss());
     return hardCoreRadius;}
 
+  // Generate all the nucleons, one at a time with generateNucleon(),
+  // or by picking a randomly rotated configuration from a pool.
+  virtual vector<Nucleon> generate() const override;
+
 protected:
 
+  // Generate the position of a single nucleon, for models that use
+  // the generate() method above. (The time component is always zero).
+  virtual Vec4 generateNucleon() const { return Vec4(); }
+
+  // Generate the positions of all nucleons, relative to their centre.
+  vector<Vec4> generatePositions() const;
+
+  // Check if a new nucleon overlaps with the hard core of earlier ones.
+  bool overlaps(const vector<Vec4>& positions, const Vec4& pos) const;
+
+  // Index of the cell of a position, and of a cell coordinate.
+  int cellIndex(const Vec4& pos) const {
+    return (cellCoord(pos.pz())*nCellSide + cellCoord(pos.py()))*nCellSide
+      + cellCoord(pos.px());}
+  int cellCoord(double x) const {
+    return max(0, min(nCellSide - 1, int((x - cellMin)/cellSize)));}
+
   // Use the hard core or not.
   bool useHardCore;
 
@@ -324,6 +346,26 @@ protected:
   // The radius or width of the hard core.
   double hardCoreRadius;
 
+  // Number of configurations in the pool, zero if no pool is used.
+  int nPool;
+
+private:
+
+  // Constants: could only be changed in the code itself.
+  static const int MAXCELLSIDE;
+
+  // For a fixed-radius hard core, cubic cells of at least the radius
+  // size, so that overlaps need only be checked with nucleons in the
+  // neighbouring cells. Positions outside the grid are put in the edge
+  // cells. For each cell the first nucleon in it, and for each nucleon
+  // the next one in the same cell.
+  mutable int nCellSide;
+  mutable double cellSize, cellMin;
+  mutable vector<int> cellFirst, cellNext;
+
+  // The pool of nucleon configurations, filled when first used.
+  mutable vector< vector<Vec4> > poolSave;
+
 };
 
 //==========================================================================
@@ -345,9 +387,6 @@ public:
   // Initialize parameters.
   bool init() override;
 
-  // Generate all the nucleons.
-  vector<Nucleon> generate() const override;
-
   // Accessor functions.
   double a() const { return aSave; }
 
@@ -355,7 +394,7 @@ protected:
 
   // Generate the position of a single nucleon. (The time component
   // is always zero).
-  Vec4 generateNucleon() const;
+  Vec4 generateNucleon() const override;
 
   // Calculate overestimates for sampling.
   void overestimates() {
@@ -416,15 +455,11 @@ public:
   // Initialize, set up parameters.
   virtual bool init() override;
 
-  // Generate a vector of nucleons according to the implemented model
-  // for a nucleus given by the PDG number.
-  virtual vector<Nucleon> generate() const override;
-
 protected:
 
   // Generate the position of a single nucleon. (The time component
   // is always zero).
-  virtual Vec4 generateNucleon() const;
+  virtual Vec4 generateNucleon() const override;
 
   // The density function.
   double rho(double r) const {
@@ -496,15 +531,11 @@ public:
 
   virtual bool init() override;
 
-  // Generate a vector of nucleons according to the implemented model
-  // for a nucleus given by the PDG number.
-  virtual vector<Nucleon> generate() const override;
-
 protected:
 
   // Generate the position of a single nucleon. (The time component
   // is always zero).
-  virtual Vec4 generateNucleon() const;
+  virtual Vec4 generateNucleon() const override;
 
   // Nucleus charge radius.
   double nucleusChR;
@@ -147,7 +147,8 @@ public:
   SubCollisionModel(int nParm): sigTarg(8, 0.0), sigErr(8, 0.05),
     parmSave(nParm),
     NInt(100000), NPop(20), sigFuzz(0.2), impactFudge(1),
-    fitPrint(true), avNDb(1.0*femtometer),
+    fitPrint(true), doParallelFit(false), nThreadsFit(0), modelSave(-1),
+    avNDb(1.0*femtometer),
     projPtr(), targPtr(), sigTotPtr(), settingsPtr(), infoPtr(), rndmPtr() {}
 
   // Virtual destructor.
@@ -261,6 +262,10 @@ private:
   bool saveParms(string fileName) const;
   bool loadParms(string fileName);
 
+  // Calculate the Chi2 for each parameter set in a population.
+  void calcChi2Pop(const vector< vector<double> >& pop,
+    vector<double>& chi2Pop);
+
 protected:
 
   // Saved parameters.
@@ -273,6 +278,11 @@ protected:
   double impactFudge;
   bool fitPrint;
 
+  // Evaluate the population of the fit on several threads. The model
+  // number, if made by create(), used to make a copy for each thread.
+  bool doParallelFit;
+  int nThreadsFit, modelSave;
+
   // The estimated average impact parameter distance (in femtometer)
   // for absorptive collisions.
   double avNDb;
@@ -108,7 +108,7 @@ protected:
 private:
 
   // Constants: could only be changed in the code itself.
-  static const double MTINY;
+  static const double MTINY, GRAMMINRESC, B2MARGINRESC;
 
   // Initialization data, read from Settings.
   bool doHadronize{}, doDecay{}, doPartonVertex{}, doBoseEinstein{},
@@ -177,6 +177,11 @@ private:
   double b2Max, tauRegeneration{};
   void queueDecResc(Event& event, int iStart,
     priority_queue<HadronLevel::PriorityNode>& queue);
+  bool outsideB2Max(const Particle& hadA, const Particle& hadB);
+
+  // Final hadrons that may rescatter, in increasing order, and the primary
+  // hadron mother of each event entry. Updated as new hadrons are added.
+  vector<int> iRescatter, iPrimaryRescatter;
   int boostDir;
   double boost;
   bool doBoost;
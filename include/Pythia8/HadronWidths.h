@@ -41,8 +41,8 @@ public:
 
   // Returns whether the specified particle is handled by HadronWidths.
   bool hasData(int id) const {
-    auto iter = entries.find(abs(id));
-    return iter != entries.end();
+    auto iter = tablesPtr->entries.find(abs(id));
+    return iter != tablesPtr->entries.end();
   }
 
   // Get whether the resonance can decay into the specified products.
@@ -109,15 +109,23 @@ private:
     bool isUserDefined;
   };
 
-  // Map from particle id to corresponding HadronWidthEntry.
-  map<int, HadronWidthEntry> entries;
+  // The width tables, which may be shared with other HadronWidths objects.
+  struct Tables {
+
+    // Map from particle id to corresponding HadronWidthEntry.
+    map<int, HadronWidthEntry> entries;
+
+    // Map from signatures to candidate resonances. Used for optimization.
+    map<int, vector<int>> signatureToParticles;
+
+  };
+
+  // The tables in use, owned by this object or shared with others.
+  CopyOnWrite<Tables> tablesPtr;
 
   // Gets key for the decay and flips idR if necessary
   pair<int, int> getKey(int& idR, int idA, int idB) const;
 
-  // Map from signatures to candidate resonances. Used for optimization.
-  map<int, vector<int>> signatureToParticles;
-
   // Get signature of system based on total baryon number and electric charge.
   int getSignature(int baryonNumber, int charge) const;
 
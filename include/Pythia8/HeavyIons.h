@@ -190,6 +190,10 @@ public:
   // Produce a collision involving heavy ions.
   virtual bool next() override;
 
+  // Print statistics, including errors from the worker copies of the
+  // minimum bias object.
+  virtual void stat() override;
+
   // Set UserHooks for specific (or ALL) internal Pythia objects.
   bool setUserHooksPtr(PythiaObject sel, UserHooksPtr userHooksPtrIn);
 
@@ -272,6 +276,13 @@ protected:
   EventInfo getMBIAS(const SubCollision * coll, int procid);
   EventInfo getSASD(const SubCollision * coll, int procid);
 
+  // Generate one non-diffractive event for each of the given
+  // sub-collisions (or null pointers), concurrently if so requested.
+  vector<EventInfo> getNDs(const vector<const SubCollision*>& collsIn);
+
+  // Set up the worker copies of the minimum bias object.
+  bool initWorkers(int nThreads);
+
   bool genAbs(SubCollisionSet& subCollsIn, list<EventInfo>& subEventsIn);
   void addSASD(const SubCollisionSet& subCollsIn);
   bool addDD(const SubCollisionSet& subCollsIn, list<EventInfo>& subEventsIn);
@@ -398,6 +409,16 @@ private:
   // The process selector for the SASD object.
   shared_ptr<ProcessSelectorHook> selectSASD;
 
+  // A worker copy of the minimum bias object, with its own process
+  // selector and information, used to generate non-diffractive
+  // sub-collisions concurrently.
+  struct MBWorker {
+    Pythia* pythiaPtr;
+    shared_ptr<ProcessSelectorHook> selectPtr;
+    Info* infoPtr;
+  };
+  vector<MBWorker> mbWorkers;
+
 private:
 
   static const int MAXTRY = 999;
@@ -416,6 +437,13 @@ private:
   // Flag to determine whether to do only Glauber modelling.
   bool glauberOnly;
 
+  // Flag set if the user has given UserHooks for the MBIAS object.
+  bool hasMBHooks;
+
+  // Flag set if non-diffractive sub-collisions are generated with one
+  // random number sequence each, in parallel if there are worker copies.
+  bool parallelND;
+
   // All subcollisions in current collision.
   SubCollisionSet subColls;
 
@@ -445,6 +473,12 @@ private:
   // Different choices for handling impact parameters.
   int bMode;
 
+  // Handles to settings that are read in each event.
+  const Flag* allowVertexSpreadPtr{};
+  const Mode* sdTriesPtr{};
+  const Parm* eAPtr{};
+  const Parm* eBPtr{};
+
   // Critical internal error, abort the event.
   bool doAbort;
 
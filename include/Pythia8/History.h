@@ -100,6 +100,78 @@ public:
 
 //==========================================================================
 
+// Declaration of HistoryState and HistoryStates classes.
+// Different clustering paths often pass through identical intermediate
+// states. While the histories of an event are constructed, each distinct
+// state is therefore stored once, together with the clusterings found
+// for it, their probabilities and the states they lead to. This makes
+// up a graph where each clustering is an edge to a state, so that these
+// quantities only need to be calculated once per state.
+
+class HistoryState {
+
+public:
+
+  // Constructor.
+  HistoryState(const Event& stateIn) : state(stateIn), hasClusterings(false),
+    hasShuffledState(false), hasHardME(false), hardME(0.) {}
+
+  // The state.
+  Event state;
+
+  // The possible clusterings of the state, if found.
+  bool hasClusterings;
+  vector<Clustering> clusterings;
+
+  // The state with colours shuffled while finding the clusterings, if
+  // allowed, to which the clusterings refer.
+  bool hasShuffledState;
+  Event shuffledState;
+
+  // For each clustering: the probability, the clustered state and the
+  // position of the reclustered radiator in it, once calculated.
+  vector<bool> hasProbs;
+  vector<double> probs;
+  vector<HistoryState*> next;
+  vector<int> iReclustered;
+
+  // The hard process matrix element, if calculated.
+  bool hasHardME;
+  double hardME;
+
+  // Store the clusterings of the state.
+  void setClusterings(vector<Clustering>& clusteringsIn);
+
+};
+
+//--------------------------------------------------------------------------
+
+// The table of distinct states, with a hash lookup.
+
+class HistoryStates {
+
+public:
+
+  // Find a state in the table, or add it if not found.
+  HistoryState& find(const Event& event);
+
+  // Number of distinct states.
+  int size() const {return statesSave.size();}
+
+private:
+
+  // The states, and their positions indexed by a hash of the state.
+  deque<HistoryState> statesSave;
+  unordered_map<size_t, vector<HistoryState*> > indexSave;
+
+  // Hash of an event, and comparison of two events.
+  static size_t hash(const Event& event);
+  static bool equal(const Event& event1, const Event& event2);
+
+};
+
+//==========================================================================
+
 // Declaration of History class
 //
 // A History object represents an event in a given step in the CKKW-L
@@ -556,6 +628,12 @@ private:
   // OUT clustered state
   Event cluster( Clustering & inSystem);
 
+  // Probability and clustered state for the clustering of index iClus
+  // of the current state, only calculated if not already stored in the
+  // table of distinct states.
+  double getProb( HistoryState& stateNow, int iClus);
+  const Event& cluster( HistoryState& stateNow, int iClus);
+
   // Function to get the flavour of the radiator before the splitting
   // for clustering
   // IN  int   : Position of the radiator after the splitting, in the event
@@ -888,6 +966,10 @@ private:
   // Flag to include the path amongst allowed paths.
   bool doInclude;
 
+  // Table of distinct states, shared by all nodes while the histories
+  // are constructed, and null afterwards.
+  HistoryStates* statesPtr;
+
   // Pointer to MergingHooks object to get all the settings.
   MergingHooksPtr mergingHooksPtr;
 
@@ -895,7 +977,8 @@ private:
   History() : mother(), selectedChild(), sumpath(), sumGoodBranches(),
     sumBadBranches(), foundOrderedPath(), foundStronglyOrderedPath(),
     foundAllowedPath(), foundCompletePath(), scale(), nextInInput(), prob(),
-    iReclusteredOld(), iReclusteredNew(), doInclude(), mergingHooksPtr(),
+    iReclusteredOld(), iReclusteredNew(), doInclude(), statesPtr(),
+    mergingHooksPtr(),
     particleDataPtr(), infoPtr(), loggerPtr(), showers(), coupSMPtr(),
     sumScalarPT(), probMaxSave(), depth(), minDepthSave() {}
 
@@ -15,6 +15,7 @@
 #include "Pythia8/Logger.h"
 #include "Pythia8/PythiaStdlib.h"
 #include "Pythia8/SharedPointers.h"
+#include "Pythia8/SharedTables.h"
 #include "Pythia8/Weights.h"
 
 namespace Pythia8 {
@@ -114,6 +115,14 @@ public:
 
   WeightContainer* weightContainerPtr{};
 
+  // Pointer to tables shared with other Pythia instances.
+  // (Is NULL if tables are not shared.)
+  SharedTablesPtr sharedTablesPtr{};
+
+  // Hash of the particle data, found once per Pythia::init() for the keys
+  // of the shared tables. (Is empty if tables are not shared.)
+  string sharedTablesKey{};
+
   // Listing of most available information on current event.
   void   list() const;
 
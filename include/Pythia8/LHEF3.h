@@ -825,14 +825,16 @@ public:
   // filename: the name of the file to read from.
   //
   Reader(string filenameIn)
-    : filename(filenameIn), intstream(nullptr), file(nullptr), version() {
+    : filename(filenameIn), intstream(nullptr), file(nullptr),
+      streamParsing(true), nWgtSave(0), version() {
     intstream = new igzstream(filename.c_str());
     file = intstream;
     isGood = init();
   }
 
   Reader(istream* is)
-    : filename(""), intstream(nullptr), file(is), version() {
+    : filename(""), intstream(nullptr), file(is), streamParsing(true),
+      nWgtSave(0), version() {
     isGood = init();
   }
 
@@ -870,6 +872,13 @@ public:
   // member variable.
   bool readEvent(HEPEUP * peup = 0);
 
+  // Switch between the streaming parsing of events (default) and the
+  // generic one, where all event comments are parsed into XML tags.
+  // The results are identical, but the streaming one avoids most
+  // memory allocations, and is much faster for many weights per event.
+  void setStreamParsing(bool streamParsingIn) {
+    streamParsing = streamParsingIn;}
+
   // Reset values of all event-related members to their defaults.
   void clearEvent() {
    currentLine = "";
@@ -906,6 +915,27 @@ protected:
   // The last line read in from the stream in getline().
   string currentLine;
 
+  // Use streaming parsing of events.
+  bool streamParsing;
+
+  // Buffers reused between events by the streaming parsing: the ids and
+  // values of the wgt tags found, the text around them in the rwgt block,
+  // and the comments left over.
+  vector<string> wgtIdsSave;
+  vector<double> wgtValuesSave;
+  int            nWgtSave;
+  string         rwgtContentsSave, commentsSave;
+
+  // Streaming parsing of an event, used by readEvent().
+  bool readEventStream(HEPEUP & eup);
+
+  // Store the wgt tags found by the streaming parsing in the event,
+  // reusing the existing storage if the ids are the same as before.
+  void setDetailedWeights(HEPEUP & eup, bool found);
+
+  // Store the information of the XML tags found among the event comments.
+  void setEventTags(const vector<XMLTag*> & tags, HEPEUP & eup);
+
 public:
 
   // Save if the initialisation worked.
@@ -7,6 +7,7 @@
 // LHAProcess: stores a single process; used by the other classes.
 // LHAParticle: stores a single particle; used by the other classes.
 // LHAup: base class for initialization and event information.
+// LHEFDispatcher: reads a Les Houches Event File for several LHAupLHEF.
 // LHAupLHEF: derived class for reading from an Les Houches Event File.
 // Code for interfacing with Fortran commonblocks is found in LHAFortran.h.
 
@@ -341,6 +342,73 @@ private:
 
 //==========================================================================
 
+// The LHEFDispatcher class reads a Les Houches Event File in a separate
+// thread, and hands out the events one at a time to any number of
+// LHAupLHEF objects, e.g. one per PythiaParallel instance. Thereby the
+// file is decompressed and parsed only once, and each event is used once.
+
+class LHEFDispatcher {
+
+public:
+
+  // Constructor. At most bufferSizeIn events are read ahead, and the
+  // first nSkipIn events of the file are skipped.
+  LHEFDispatcher(string fileNameIn, int bufferSizeIn = 100, int nSkipIn = 0)
+    : fileName(fileNameIn), bufferSize(max(1, bufferSizeIn)),
+    nSkip(nSkipIn), atEnd(false), doStop(false), nReadSave(0) {}
+
+  // Destructor. Stops the reader thread.
+  ~LHEFDispatcher() {stop();}
+
+  // Read the header and init blocks, and start the reader thread.
+  bool init();
+
+  // Stop the reader thread. Events not yet handed out are discarded.
+  void stop();
+
+  // The text of the file up to and including the init block.
+  const string& initBlock() const {return initBlockSave;}
+
+  // Copy the next event into a Reader, as if read by the Reader itself.
+  // Waits until an event is available. Returns false at the end of file.
+  bool nextEvent(Reader& reader);
+
+  // Number of events read from the file so far.
+  long nRead() const {return nReadSave;}
+
+private:
+
+  // An event, with the additional information stored in the Reader.
+  struct EventRecord {
+    HEPEUP         hepeup;
+    string         eventComments;
+    vector<double> weightsDetailed;
+    vector<string> weightNamesDetailed;
+  };
+
+  // Main loop of the reader thread.
+  void readEvents();
+
+  // Properties of the file and the reading.
+  string fileName;
+  int    bufferSize, nSkip;
+  string initBlockSave;
+
+  // The Reader and the thread that runs it.
+  unique_ptr<Reader> readerPtr;
+  thread readerThread;
+
+  // Queue of events read but not yet handed out, with synchronization.
+  deque<unique_ptr<EventRecord> > eventQueue;
+  mutex              queueMutex;
+  condition_variable notEmpty, notFull;
+  bool               atEnd, doStop;
+  atomic<long>       nReadSave;
+
+};
+
+//==========================================================================
+
 // A derived class with information read from a Les Houches Event File.
 
 class LHAupLHEF : public LHAup {
@@ -371,6 +439,17 @@ public:
     isHead_gz = (headerfile == nullptr) ? is_gz : new igzstream(headerfile);
   }
 
+  // Constructor for events handed out by a dispatcher shared with other
+  // LHAupLHEF objects. Only the init block is parsed here.
+  LHAupLHEF(Pythia8::Info* infoPtrIn, LHEFDispatcherPtr dispatcherPtrIn,
+    bool readHeadersIn = false, bool setScalesFromLHEFIn = false ) :
+    filename(""), headerfile(nullptr), is(&isInitBlock), is_gz(nullptr),
+    isHead(&isInitBlock), isHead_gz(nullptr),
+    isInitBlock(dispatcherPtrIn->initBlock()), readHeaders(readHeadersIn),
+    reader(is), setScalesFromLHEF(setScalesFromLHEFIn),
+    hasExtFileStream(true), hasExtHeaderStream(true),
+    dispatcherPtr(dispatcherPtrIn) {setPtr(infoPtrIn);}
+
   // Destructor.
   ~LHAupLHEF() {
      // Close files
@@ -467,6 +546,9 @@ private:
   igzstream  *isHead_gz;
   ifstream  ifsHead;
 
+  // Header and init blocks when events are taken from a dispatcher.
+  istringstream isInitBlock;
+
   // Flag to read headers or not
   bool readHeaders;
 
@@ -475,6 +557,9 @@ private:
   // Flag to set particle production scales or not.
   bool setScalesFromLHEF, hasExtFileStream, hasExtHeaderStream;
 
+  // Optional dispatcher of events shared with other LHAupLHEF objects.
+  LHEFDispatcherPtr dispatcherPtr;
+
 };
 
 //==========================================================================
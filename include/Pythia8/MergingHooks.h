@@ -543,6 +543,9 @@ public:
 
   // Save input event in case decay products need to be detached.
   Event inputEvent;
+
+  // Event records reused by the trial showers of the History class.
+  Event trialProcess, trialEvent;
   vector< pair<int,int> > resonances;
   bool doRemoveDecayProducts;
 
@@ -334,6 +334,9 @@ private:
   bool saveMPIdata();
   bool loadMPIdata();
 
+  // Set current values from stored initialization data.
+  void setMPIdata();
+
   // Evaluate "Sudakov form factor" for not having a harder interaction.
   double sudakov(double pT2sud, double enhance = 1.);
 
@@ -90,11 +90,19 @@ private:
     double scaleFactor;
   };
 
-  // The available excitation channels.
-  vector<ExcitationChannel> excitationChannels;
+  // The cross section tables, which may be shared with other objects.
+  struct Tables {
 
-  // Total excitation cross section, precalculated for efficiency.
-  LinearInterpolator sigmaTotal;
+    // The available excitation channels.
+    vector<ExcitationChannel> excitationChannels;
+
+    // Total excitation cross section, precalculated for efficiency.
+    LinearInterpolator sigmaTotal;
+
+  };
+
+  // The tables in use, owned by this object or shared with others.
+  CopyOnWrite<Tables> tablesPtr;
 
   // Get total available phase space.
   double psSize(double eCM, ParticleDataEntry& prodA,
@@ -107,6 +107,10 @@ public:
   double openSec(int idSgn) const {
     return (idSgn > 0) ? openSecPos : openSecNeg;}
 
+  // Write to, or read back from, a binary snapshot.
+  void writeSnapshot(SnapshotWriter& writer) const;
+  bool readSnapshot(SnapshotReader& reader);
+
 private:
 
   // Decay channel info.
@@ -377,6 +381,10 @@ public:
   double resWidthRescaleFactor();
   double resWidthChan(double mHat, int idAbs1 = 0, int idAbs2 = 0);
 
+  // Write to, or read back from, a binary snapshot.
+  void writeSnapshot(SnapshotWriter& writer) const;
+  bool readSnapshot(SnapshotReader& reader);
+
 private:
 
   // Constants: could only be changed in the code itself.
@@ -427,7 +435,8 @@ public:
   ParticleData() : setRapidDecayVertex(), modeBreitWigner(), maxEnhanceBW(),
     mQRun(), Lambda5Run(), intermediateTau0(), infoPtr(nullptr),
     settingsPtr(nullptr), rndmPtr(nullptr), coupSMPtr(nullptr),
-    particlePtr(nullptr), isInit(false), readingFailedSave(false) {}
+    particlePtr(nullptr), isInit(false), readingFailedSave(false) {
+    rebuildIndex();}
 
   // Copy constructor.
   ParticleData( const ParticleData& oldPD) {
@@ -439,7 +448,7 @@ public:
       int idTmp = pde->first;
       pdt[idTmp] = make_shared<ParticleDataEntry>(*pde->second);
       pdt[idTmp]->initPtr(this); }
-    particlePtr = nullptr; isInit = oldPD.isInit;
+    rebuildIndex(); particlePtr = nullptr; isInit = oldPD.isInit;
     readingFailedSave = oldPD.readingFailedSave; }
 
   // Assignment operator.
@@ -452,7 +461,7 @@ public:
       int idTmp = pde->first;
       pdt[idTmp] = make_shared<ParticleDataEntry>(*pde->second);
       pdt[idTmp]->initPtr(this); }
-    particlePtr = nullptr; isInit = oldPD.isInit;
+    rebuildIndex(); particlePtr = nullptr; isInit = oldPD.isInit;
     readingFailedSave = oldPD.readingFailedSave; } return *this; }
 
   // Initialize pointers.
@@ -496,6 +505,10 @@ public:
   bool readFF(istream& is, bool reset = true);
   void listFF(string outFile);
 
+  // Write the full database to, or replace it from, a binary snapshot.
+  void writeSnapshot(SnapshotWriter& writer) const;
+  bool readSnapshot(SnapshotReader& reader);
+
   // Read in one update from a single line.
   bool readString(string lineIn, bool warn = true) ;
 
@@ -535,7 +548,7 @@ public:
     pdt[abs(idIn)] = make_shared<ParticleDataEntry>(idIn, nameIn, spinTypeIn,
       chargeTypeIn, colTypeIn, m0In, mWidthIn, mMinIn, mMaxIn, tau0In,
       varWidthIn);
-    pdt[abs(idIn)]->initPtr(this); }
+    pdt[abs(idIn)]->initPtr(this); updateIndex(abs(idIn)); }
   void addParticle(int idIn, string nameIn, string antiNameIn,
     int spinTypeIn = 0, int chargeTypeIn = 0, int colTypeIn = 0,
     double m0In = 0., double mWidthIn = 0., double mMinIn = 0.,
@@ -543,39 +556,30 @@ public:
     pdt[abs(idIn)] = make_shared<ParticleDataEntry>(idIn, nameIn, antiNameIn,
       spinTypeIn, chargeTypeIn, colTypeIn, m0In, mWidthIn, mMinIn, mMaxIn,
       tau0In, varWidthIn);
-    pdt[abs(idIn)]->initPtr(this); }
+    pdt[abs(idIn)]->initPtr(this); updateIndex(abs(idIn)); }
 
   // Reset all the properties of an entry in one go.
   void setAll(int idIn, string nameIn, string antiNameIn,
     int spinTypeIn = 0, int chargeTypeIn = 0, int colTypeIn = 0,
     double m0In = 0., double mWidthIn = 0., double mMinIn = 0.,
     double mMaxIn = 0.,double tau0In = 0.,bool varWidthIn = false) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setAll( nameIn, antiNameIn, spinTypeIn, chargeTypeIn,
     colTypeIn, m0In, mWidthIn, mMinIn, mMaxIn, tau0In, varWidthIn); }
 
   // Query existence of an entry.
-  bool isParticle(int idIn) const {
-    auto found = pdt.find( abs(idIn) );
-    if ( found == pdt.end() ) return false;
-    if ( idIn > 0 || found->second->hasAnti() ) return true;
-    return false;
-  }
+  bool isParticle(int idIn) const {return findSlot(idIn) != nullptr;}
 
   // Query existence of an entry and return an iterator.
   ParticleDataEntryPtr findParticle(int idIn) {
-    auto found = pdt.find( abs(idIn) );
-    if( found == pdt.end() ) return nullptr;
-    if ( idIn > 0 || found->second->hasAnti() ) return found->second;
-    return nullptr;
+    const ParticleDataEntryPtr* slot = findSlot(idIn);
+    return (slot) ? *slot : nullptr;
   }
 
   // Query existence of an entry and return a const iterator.
   const ParticleDataEntryPtr findParticle(int idIn) const {
-    auto found = pdt.find( abs(idIn) );
-    if( found == pdt.end() ) return nullptr;
-    if ( idIn > 0 || found->second->hasAnti() ) return found->second;
-    return nullptr;
+    const ParticleDataEntryPtr* slot = findSlot(idIn);
+    return (slot) ? *slot : nullptr;
   }
 
   // Return the id of the sequentially next particle stored in table.
@@ -587,235 +591,235 @@ public:
 
   // Change current values one at a time (or set if not set before).
   void name(int idIn, string nameIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setName(nameIn); }
   void antiName(int idIn, string antiNameIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setAntiName(antiNameIn); }
   void names(int idIn, string nameIn, string antiNameIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setNames(nameIn, antiNameIn); }
   void spinType(int idIn, int spinTypeIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setSpinType(spinTypeIn); }
   void chargeType(int idIn, int chargeTypeIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setChargeType(chargeTypeIn); }
   void colType(int idIn, int colTypeIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setColType(colTypeIn); }
   void m0(int idIn, double m0In) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setM0(m0In); }
   void mWidth(int idIn, double mWidthIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setMWidth(mWidthIn); }
   void mMin(int idIn, double mMinIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setMMin(mMinIn); }
   void mMax(int idIn, double mMaxIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setMMax(mMaxIn); }
   void tau0(int idIn, double tau0In) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setTau0(tau0In); }
   void isResonance(int idIn, bool isResonanceIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setIsResonance(isResonanceIn); }
   void mayDecay(int idIn, bool mayDecayIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setMayDecay(mayDecayIn); }
   void tauCalc(int idIn, bool tauCalcIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setTauCalc(tauCalcIn); }
   void doExternalDecay(int idIn, bool doExternalDecayIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setDoExternalDecay(doExternalDecayIn); }
   void varWidth(int idIn, bool varWidthIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setVarWidth(varWidthIn); }
   void isVisible(int idIn, bool isVisibleIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setIsVisible(isVisibleIn); }
   void doForceWidth(int idIn, bool doForceWidthIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setDoForceWidth(doForceWidthIn); }
   void hasChanged(int idIn, bool hasChangedIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setHasChanged(hasChangedIn); }
 
   // Give back current values.
   bool hasAnti(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->hasAnti() : false; }
   int antiId(int idIn) const {
     if (idIn < 0) return -idIn;
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->antiId() : 0; }
   string name(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->name(idIn) : " "; }
   int spinType(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->spinType() : 0; }
   int chargeType(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->chargeType(idIn) : 0; }
   double charge(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->charge(idIn) : 0; }
   int colType(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->colType(idIn) : 0 ; }
   double m0(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->m0() : 0. ; }
   double mWidth(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mWidth() : 0. ; }
   double mMin(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mMin() : 0. ; }
   double m0Min(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->m0Min() : 0. ; }
   double mMax(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mMax() : 0. ; }
   double m0Max(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->m0Max() : 0. ; }
   double tau0(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->tau0() : 0. ; }
   bool isResonance(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isResonance() : false ; }
   bool mayDecay(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mayDecay() : false ; }
   bool tauCalc(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->tauCalc() : false ; }
   bool doExternalDecay(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->doExternalDecay() : false ; }
   bool isVisible(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isVisible() : false ; }
   bool doForceWidth(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->doForceWidth() : false ; }
   bool hasChanged(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->hasChanged() : false ; }
   bool hasChangedMMin(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->hasChangedMMin() : false ; }
   bool hasChangedMMax(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->hasChangedMMax() : false ; }
 
   // Give back special mass-related quantities.
   bool useBreitWigner(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->useBreitWigner() : false ; }
   bool varWidth(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->varWidth() : false; }
   double constituentMass(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->constituentMass() : 0. ; }
   double mSel(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mSel() : 0. ; }
   double mRun(int idIn, double mH) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->mRun(mH) : 0. ; }
 
   // Give back other quantities.
   bool canDecay(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->canDecay() : false ; }
   bool isLepton(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isLepton() : false ; }
   bool isQuark(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isQuark() : false ; }
   bool isGluon(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isGluon() : false ; }
   bool isDiquark(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isDiquark() : false ; }
   bool isParton(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isParton() : false ; }
   bool isHadron(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isHadron() : false ; }
   bool isMeson(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isMeson() : false ; }
   bool isBaryon(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isBaryon() : false ; }
   bool isOnium(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isOnium() : false ; }
   bool isExotic(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isExotic() : false ; }
   bool isOctetHadron(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->isOctetHadron() : false ; }
   int heaviestQuark(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->heaviestQuark(idIn) : 0 ; }
   int baryonNumberType(int idIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->baryonNumberType(idIn) : 0 ; }
   int nQuarksInCode(int idIn, int idQIn) const {
-    const ParticleDataEntryPtr ptr = findParticle(idIn);
+    const ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->nQuarksInCode(idQIn) : 0 ; }
 
   // Change branching ratios.
   void rescaleBR(int idIn, double newSumBR = 1.) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->rescaleBR(newSumBR); }
 
   // Access methods stored in ResonanceWidths.
   void setResonancePtr(int idIn, ResonanceWidthsPtr resonancePtrIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->setResonancePtr( resonancePtrIn);}
   void resInit(int idIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     if ( ptr ) ptr->resInit(infoPtr);}
   double resWidth(int idIn, double mHat, int idInFlav = 0,
     bool openOnly = false, bool setBR = false) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidth(idIn, mHat,
     idInFlav, openOnly, setBR) : 0.;}
   double resWidthOpen(int idIn, double mHat, int idInFlav = 0) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidthOpen(idIn, mHat, idInFlav) : 0.;}
   double resWidthStore(int idIn, double mHat, int idInFlav = 0) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidthStore(idIn, mHat, idInFlav) : 0.;}
   double resOpenFrac(int id1In, int id2In = 0, int id3In = 0);
   double resWidthRescaleFactor(int idIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidthRescaleFactor() : 0.;}
   double resWidthChan(int idIn, double mHat, int idAbs1 = 0,
     int idAbs2 = 0) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
+    ParticleDataEntry* ptr = findEntry(idIn);
     return ( ptr ) ? ptr->resWidthChan( mHat, idAbs1, idAbs2) : 0.;}
 
   // Return pointer to entry.
   ParticleDataEntryPtr particleDataEntryPtr(int idIn) {
-    ParticleDataEntryPtr ptr = findParticle(idIn);
-    return ( ptr ) ? ptr : pdt[0]; }
+    const ParticleDataEntryPtr* slot = findSlot(idIn);
+    return ( slot ) ? *slot : pdt[0]; }
 
   // Check initialisation status.
   bool getIsInit() {return isInit;}
@@ -845,9 +849,44 @@ private:
   // Pointer to Standard Model couplings.
   CoupSM* coupSMPtr;
 
+  // Constants: could only be changed in the code itself.
+  static const int DIRECTIDMAX;
+
   // All particle data stored in a map.
   map<int, ParticleDataEntryPtr> pdt;
 
+  // Direct index into the map for codes below DIRECTIDMAX, which covers
+  // the ordinary ground-state codes; excited hadrons and all others go
+  // through the map. Map nodes are stable, so the index only needs to be
+  // updated when entries are added or removed.
+  vector<const ParticleDataEntryPtr*> directIndex;
+
+  // Locate the map entry of a particle, or nullptr if there is none.
+  const ParticleDataEntryPtr* findSlot(int idIn) const {
+    int idAbs = abs(idIn);
+    const ParticleDataEntryPtr* slot = nullptr;
+    if (idAbs < DIRECTIDMAX) slot = directIndex[idAbs];
+    else {
+      auto found = pdt.find(idAbs);
+      if (found != pdt.end()) slot = &found->second;
+    }
+    if (slot == nullptr || !*slot) return nullptr;
+    return (idIn > 0 || (*slot)->hasAnti()) ? slot : nullptr;
+  }
+  ParticleDataEntry* findEntry(int idIn) const {
+    const ParticleDataEntryPtr* slot = findSlot(idIn);
+    return (slot) ? slot->get() : nullptr;
+  }
+
+  // Update the direct index after a change of the map.
+  void updateIndex(int idAbs) {
+    if (idAbs < 0 || idAbs >= DIRECTIDMAX) return;
+    auto found = pdt.find(idAbs);
+    directIndex[idAbs] = (found == pdt.end()) ? nullptr : &found->second;}
+  void rebuildIndex() {directIndex.assign(DIRECTIDMAX, nullptr);
+    for (const auto& entry : pdt) if (entry.first >= 0
+      && entry.first < DIRECTIDMAX) directIndex[entry.first] = &entry.second;}
+
   // Pointer to current particle (e.g. when reading decay channels).
   ParticleDataEntryPtr particlePtr;
 
@@ -219,54 +219,103 @@ class LHAGrid1 : public PDF {
 
 public:
 
-  // Constructor.
+  // Constructor. Optionally the grid can be shared with other objects
+  // that read the same file.
   LHAGrid1(int idBeamIn = 2212, string pdfWord = "void",
-    string xmlPath = "../share/Pythia8/xmldoc/", Logger* loggerPtr = 0)
-    : PDF(idBeamIn), doExtraPol(false), nx(), nq(), nqSub(), xMin(), xMax(),
-    qMin(), qMax(), pdfVal(), pdfGrid(), pdfSlope(nullptr) {
-    init( pdfWord, xmlPath, loggerPtr); };
+    string xmlPath = "../share/Pythia8/xmldoc/", Logger* loggerPtr = 0,
+    SharedTablesPtr sharedTablesPtr = nullptr)
+    : PDF(idBeamIn), doExtraPol(false), pdfVal(), gridPtr() {
+    init( pdfWord, xmlPath, loggerPtr, sharedTablesPtr); };
 
   // Constructor with a stream.
   LHAGrid1(int idBeamIn, istream& is, Logger* loggerPtr = 0)
-    : PDF(idBeamIn), doExtraPol(false), nx(), nq(), nqSub(), xMin(), xMax(),
-    qMin(), qMax(), pdfVal(), pdfGrid(), pdfSlope(nullptr) {
+    : PDF(idBeamIn), doExtraPol(false), pdfVal(), gridPtr() {
     init( is, loggerPtr); };
 
-  // Destructor.
-  ~LHAGrid1() { for (int iid = 0; iid < 12; ++iid) {
-    for (int iq = 0; iq < nq; ++iq) delete[] pdfGrid[iid][iq];
-    delete[] pdfGrid[iid]; }
-    if (pdfSlope) { for (int iid = 0; iid < 12; ++iid) delete[] pdfSlope[iid];
-    delete[] pdfSlope;} };
-
   // Allow extrapolation beyond boundaries. This is optional.
   void setExtrapolate(bool doExtraPolIn) override {doExtraPol = doExtraPolIn;}
 
+  // Evaluate x*f(x, Q2) for all flavours at several (x, Q2) points at once.
+  // On return xfs[12 * i + iid] holds the value for point i, with iid
+  // = 0 for g, 1 - 5 for d, u, s, c, b, 6 - 10 for the corresponding
+  // antiquarks and 11 for gamma, for a proton beam. These are the raw
+  // interpolated values, so may be negative, unlike those of xf(...).
+  // Values are zero at or above the largest x of the grid.
+  void xfAll(const vector<double>& x, const vector<double>& Q2,
+    vector<double>& xfs) const;
+
 private:
 
+  // Constants: could only be changed in the code itself.
+  static const int NFLAV, ALIGNBYTES;
+
+  // The grid as read from file. It is never changed after reading,
+  // so can be shared between several LHAGrid1 objects.
+  struct Grid {
+
+    // Constructor.
+    Grid() : nx(), nq(), nqSub(), xMin(), xMax(), qMin(), qMax(),
+      pdfGrid(nullptr), pdfSlope(nullptr) {}
+
+    // Objects of this class point into their own storage, so should
+    // not be copied.
+    Grid(const Grid&) = delete;
+    Grid& operator=(const Grid&) = delete;
+
+    // Allocate zeroed storage for PDF values and small-x slopes.
+    void allocate();
+
+    // PDF values for all flavours at a grid point, and small-x slopes.
+    const double* pdf(int iq, int ix) const {
+      return pdfGrid + (iq * nx + ix) * NFLAV;}
+    double* pdf(int iq, int ix) { return pdfGrid + (iq * nx + ix) * NFLAV;}
+    const double* slope(int iq) const { return pdfSlope + iq * NFLAV;}
+
+    // The grid points.
+    int    nx, nq, nqSub;
+    vector<int> nqSum;
+    double xMin, xMax, qMin, qMax;
+    vector<double> xGrid, lnxGrid, qGrid, lnqGrid, qDiv;
+
+    // The PDF values are stored contiguously, with the NFLAV flavours of
+    // each grid point next to each other, so that all flavours can be
+    // interpolated together in vectorizable loops. Likewise for the
+    // slopes used for extrapolation to small x. The pointers are aligned
+    // to ALIGNBYTES boundaries inside the storage vectors.
+    vector<double> pdfStore, slopeStore;
+    double* pdfGrid;
+    double* pdfSlope;
+
+  };
+
   // Variables to be set during code initialization.
   bool   doExtraPol;
-  int    nx, nq, nqSub;
-  vector<int> nqSum;
-  double xMin, xMax, qMin, qMax, pdfVal[12];
-  vector<double> xGrid, lnxGrid, qGrid, lnqGrid, qDiv;
-  double** pdfGrid[12];
-  double** pdfSlope;
+  double pdfVal[12];
+  shared_ptr<const Grid> gridPtr;
 
   // These inits do not overwrite PDF init (prevents Clang warnings).
   using PDF::init;
 
   // Initialization of data array.
-  void init( string pdfSet, string pdfdataPath, Logger* loggerPtr);
+  void init( string pdfSet, string pdfdataPath, Logger* loggerPtr,
+    SharedTablesPtr sharedTablesPtr);
 
   // Initialization through a stream.
   void init( istream& is, Logger* loggerPtr);
 
+  // Read in the grid from a stream. Returns nullptr if failed.
+  shared_ptr<const Grid> readGrid( istream& is, Logger* loggerPtr);
+
   // Update PDF values.
   void xfUpdate(int id, double x, double Q2) override;
 
-  // Interpolation in the grid for a given PDF flavour.
-  void xfxevolve(double x, double Q2);
+  // Interpolation in the grid for all flavours at a single point.
+  void xfxevolve(double x, double Q2) { xfxevolve( 1, &x, &Q2, pdfVal);}
+
+  // Interpolation in the grid for all flavours at nPoint points. Values
+  // at or above the largest x of the grid are not set.
+  void xfxevolve(int nPoint, const double* x, const double* Q2,
+    double* xfs) const;
 
 };
 
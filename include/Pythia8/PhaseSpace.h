@@ -89,6 +89,14 @@ public:
   // For Les Houches with negative event weight needs
   virtual double sigmaSumSigned() const {return sigmaMx;}
 
+  // Sampling maximum and coefficients from a previous initialization,
+  // to be used by the next setupSampling call instead of a new search.
+  // Currently only implemented for the 2 -> 1/2/3 tau-y-z sampling;
+  // otherwise samplingData returns an empty vector.
+  void   setSamplingData(const vector<double>& dataIn) {samplingIn = dataIn;}
+  vector<double> samplingData() const;
+  bool   reusedSampling() const {return reusedSampling123;}
+
   // Give back constructed four-vectors and known masses.
   Vec4   p(int i)   const {return pH[i];}
   double m(int i)   const {return mH[i];}
@@ -155,10 +163,11 @@ protected:
     zCoefSum(), useBW(), useNarrowBW(), idMass(), mPeak(), sPeak(), mWidth(),
     mMin(), mMax(), mw(), wmRat(), mLower(), mUpper(), sLower(), sUpper(),
     fracFlatS(), fracFlatM(), fracInv(), fracInv2(), atanLower(), atanUpper(),
-    intBW(), intFlatS(), intFlatM(), intInv(), intInv2() {}
+    intBW(), intFlatS(), intFlatM(), intInv(), intInv2(), samplingIn(),
+    hasSampling123(), reusedSampling123() {}
 
   // Constants: could only be changed in the code itself.
-  static const int    NMAXTRY, NTRY3BODY;
+  static const int    NMAXTRY, NTRY3BODY, NSAMPLINGDATA;
   static const double SAFETYMARGIN, TINY, EVENFRAC, SAMESIGMA, MRESMINABS,
                       WIDTHMARGIN, SAMEMASS, MASSMARGIN, EXTRABWWTMAX,
                       THRESHOLDSIZE, THRESHOLDSTEP, YRANGEMARGIN, LEPTONXMIN,
@@ -267,6 +276,11 @@ protected:
   void   trialMass(int iM);
   double weightMass(int iM);
 
+  // Sampling data from a previous initialization, and whether it was used.
+  vector<double> samplingIn;
+  bool   hasSampling123, reusedSampling123;
+  bool   loadSampling123();
+
   // Standard methods to find t range of a 2 -> 2 process
   // and to check whether a given t value is in that range.
   pair<double,double> tRange( double sIn, double s1In, double s2In,
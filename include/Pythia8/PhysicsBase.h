@@ -73,6 +73,15 @@ protected:
   // Register a sub object that should have its information in sync with this.
   void registerSubObject(PhysicsBase& pb);
 
+  // Hash of all changed settings, except those starting with one of the
+  // given prefixes, of the particle data and the beams, and of an extra
+  // description.
+  string setupKey(const vector<string>& skipKeys,
+    const string& extra = "") const;
+
+  // Hash of the particle data only.
+  string particleDataKey() const;
+
   // Pointer to various information on the generation.
   // This is also the place from which a number of pointers are recovered.
   Info*          infoPtr       =  {};
@@ -127,6 +136,10 @@ private:
 
   friend class Pythia;
 
+  // Write the particle data to a description, and hash a description.
+  void writeParticleData(ostream& os) const;
+  static string hashKey(const string& description);
+
   // Calls onBeginEvent, then propagates the call to all sub objects
   void beginEvent();
 
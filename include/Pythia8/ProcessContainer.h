@@ -56,12 +56,18 @@ public:
       beamAhasResGamma(), beamBhasResGamma(), beamHasResGamma(),
       beamHasGamma(), beamAgammaMode(), beamBgammaMode(), gammaModeEvent(),
       approximatedGammaFlux(), nTryRequested(), nSelRequested(),
-      nAccRequested(), sigmaTemp(), sigma2Temp(), normVar3() {}
+      nAccRequested(), sigmaTemp(), sigma2Temp(), normVar3(),
+      samplingSave() {}
 
   // Initialize phase space and counters.
   bool init(bool isFirst, ResonanceDecays* resDecaysPtrIn,
     SLHAinterface* slhaInterfacePtr, GammaKinematics* gammaKinPtrIn);
 
+  // Maximum and phase space sampling data from a previous initialization,
+  // to be used by the next init call, or the data found by the last one.
+  void setSamplingData(const vector<double>& dataIn) {samplingSave = dataIn;}
+  vector<double> samplingData() const {return samplingSave;}
+
   // Store or replace Les Houches pointer.
   void setLHAPtr( LHAupPtr lhaUpPtrIn,  ParticleData* particleDataPtrIn = 0,
     Settings* settingsPtrIn = 0, Rndm* rndmPtrIn = 0)
@@ -214,6 +220,9 @@ private:
   // Temporary summand for handling (weighted) events when vetoes are applied.
   double sigmaTemp, sigma2Temp, normVar3;
 
+  // Maximum and phase space sampling data, for reuse in a later run.
+  vector<double> samplingSave;
+
   // Estimate integrated cross section and its uncertainty.
   void sigmaDelta();
 
@@ -146,6 +146,16 @@ private:
   // Print statistics when two hard processes allowed.
   void statistics2(bool reset);
 
+  // Read or write process maxima and sampling data from/to file.
+  int    reuseInit;
+  string initFile;
+  map<int, vector<double> > samplingIn[2];
+  string initKey();
+  void   setSamplingData(int iSet, vector<ProcessContainer*>& ptrs,
+    int nPtrs);
+  bool   loadSamplingData(string key);
+  bool   saveSamplingData(string key, int nIntern);
+
 };
 
 //==========================================================================
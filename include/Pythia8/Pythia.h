@@ -19,6 +19,7 @@
 #include "Pythia8/BeamParticle.h"
 #include "Pythia8/BeamSetup.h"
 #include "Pythia8/Event.h"
+#include "Pythia8/EventFile.h"
 #include "Pythia8/FragmentationFlavZpT.h"
 #include "Pythia8/HadronLevel.h"
 #include "Pythia8/HadronWidths.h"
@@ -50,6 +51,7 @@
 #include "Pythia8/StringInteractions.h"
 #include "Pythia8/SusyCouplings.h"
 #include "Pythia8/SLHAinterface.h"
+#include "Pythia8/Snapshot.h"
 #include "Pythia8/TimeShower.h"
 #include "Pythia8/UserHooks.h"
 #include "Pythia8/VinciaCommon.h"
@@ -84,6 +86,10 @@ public:
   Pythia( istream& settingsStrings, istream& particleDataStrings,
     bool printBanner = true);
 
+  // Constructor taking the settings and particle database from a binary
+  // snapshot, written earlier by writeSnapshot, instead of XML files.
+  Pythia(const Snapshot& snapshot, bool printBanner = true);
+
   // Destructor.
   ~Pythia() {}
 
@@ -107,6 +113,10 @@ public:
   bool readFile(istream& is, int subrun) {
     return readFile(is, true, subrun);}
 
+  // Write the current settings and particle database to a binary snapshot.
+  bool writeSnapshot(string fileName) {return isConstructed
+    && Snapshot::write(fileName, settings, particleData, &logger);}
+
   // Possibility to pass in pointers to PDF's.
   bool setPDFPtr( PDFPtr pdfAPtrIn, PDFPtr pdfBPtrIn,
     PDFPtr pdfHardAPtrIn = nullptr, PDFPtr pdfHardBPtrIn = nullptr,
@@ -133,6 +143,11 @@ public:
   bool setLHAupPtr( LHAupPtr lhaUpPtrIn) {lhaUpPtr = lhaUpPtrIn;
     useNewLHA = false; return beamSetup.setLHAupPtr( lhaUpPtrIn);}
 
+  // Possibility to take Les Houches Event File input from a dispatcher
+  // shared with other Pythia instances.
+  bool setLHEFDispatcherPtr( LHEFDispatcherPtr lhefDispatcherPtrIn) {
+    return beamSetup.setLHEFDispatcherPtr( lhefDispatcherPtrIn);}
+
   // Possibility to pass in pointer for external handling of some decays.
   bool setDecayPtr( DecayHandlerPtr decayHandlePtrIn,
     vector<int> handledParticlesIn = {}) {decayHandlePtr = decayHandlePtrIn;
@@ -222,9 +237,17 @@ public:
   bool setPartonVertexPtr( PartonVertexPtr partonVertexPtrIn)
     { partonVertexPtr = partonVertexPtrIn; return true;}
 
+  // Possibility to pass in a store of read-only tables, such as PDF grids,
+  // that is shared with other Pythia instances with the same setup.
+  bool setSharedTablesPtr( SharedTablesPtr sharedTablesPtrIn)
+    { infoPrivate.sharedTablesPtr = sharedTablesPtrIn; return true;}
+
   // Initialize.
   bool init();
 
+  // Time in seconds spent in each of the main stages of the last init().
+  vector<pair<string, double> > initTimes() const { return initTimesSave; }
+
   // Generate the next event.
   bool next() { return next(0); }
   bool next(int procTypeIn);
@@ -428,6 +451,9 @@ private:
   int    nCount = {}, nShowLHA = {}, nShowInfo = {}, nShowProc = {},
          nShowEvt = {}, reconnectMode = {};
 
+  // Time spent in each initialization stage.
+  vector<pair<string, double> > initTimesSave = {};
+
   // information for error checkout.
   int    nErrEvent = {};
   vector<int> iErrId = {}, iErrCol = {}, iErrEpm = {}, iErrNan = {},
@@ -13,6 +13,72 @@ namespace Pythia8 {
 
 //==========================================================================
 
+// Compact copy of a generated event, as passed from the worker threads to
+// the consumers when PythiaParallel::runBuffered is used.
+
+struct EventSnapshot {
+
+  // The event record and the hard process.
+  Event event, process;
+
+  // Event weights, as given by Info::weightValueByIndex.
+  vector<double> weights;
+
+  // Cross section estimate of the generating instance at this point.
+  double sigmaGen = 0., sigmaErr = 0.;
+
+  // Index of the Pythia instance that generated the event.
+  int iPythia = -1;
+
+};
+
+//==========================================================================
+
+// Bounded lock-free ring buffer of event snapshots, with multiple producers
+// and one or more consumers. Each slot carries a sequence number that
+// tells whether it is free to be written or ready to be read. Slots are
+// reused, so that the event records keep their allocated memory.
+
+class EventBuffer {
+
+public:
+
+  // Constructor. The size is rounded up to a power of two, at least two.
+  EventBuffer(int sizeIn);
+
+  // Claim a free slot for writing. Returns nullptr if the buffer is full.
+  EventSnapshot* tryClaimWrite(long& ticket);
+
+  // Mark a written slot as ready to be read.
+  void commitWrite(long ticket);
+
+  // Claim the oldest ready slot for reading. Returns nullptr if empty.
+  EventSnapshot* tryClaimRead(long& ticket);
+
+  // Mark a read slot as free to be written again.
+  void commitRead(long ticket);
+
+private:
+
+  // A slot in the buffer.
+  struct Slot {
+    atomic<long> sequence;
+    EventSnapshot snapshot;
+  };
+
+  // The slots and the mask used to map positions to slots.
+  vector<Slot> slots;
+  long mask;
+
+  // Positions of the next write and read. Kept apart to limit false sharing.
+  atomic<long> writePos;
+  char padding[64];
+  atomic<long> readPos;
+
+};
+
+//==========================================================================
+
 // Class for doing Pythia runs in parallel.
 
 class PythiaParallel {
@@ -55,6 +121,14 @@ public:
   vector<long> run(function<void(Pythia*)> callback) {
     return run(settings.mode("Main:numberOfEvents"), callback); }
 
+  // Generate events in parallel, passing copies of them through a
+  // buffer to separate consumer threads. With several consumer threads
+  // the consumer calls may overlap and complete in any order.
+  vector<long> runBuffered(long nEvents,
+    function<void(const EventSnapshot&)> consumer);
+  vector<long> runBuffered(function<void(const EventSnapshot&)> consumer) {
+    return runBuffered(settings.mode("Main:numberOfEvents"), consumer); }
+
   // Pythia object used for loading data.
   Pythia pythiaHelper;
 
@@ -64,6 +138,11 @@ public:
   // Sum of weights from all Pythia instances.
   double weightSum() const { return weightSumSave; }
 
+  // Time in seconds each thread spent generating and processing events,
+  // and time spent waiting, in the last call to run.
+  vector<double> busyTime() const { return busyTimeSave; }
+  vector<double> idleTime() const { return idleTimeSave; }
+
   // The settings that will be used to initialize Pythia instances.
   Settings& settings;
 
@@ -81,11 +160,46 @@ private:
   // Sum of weights and weighted cross section.
   double weightSumSave, sigmaGenSave;
 
+  // Busy and idle time per thread in the last run.
+  vector<double> busyTimeSave, idleTimeSave;
+
   // Configuration flags.
   int numThreads;
   bool processAsync;
   bool balanceLoad;
+  bool workStealing;
   bool doNext;
+  int chunkSize;
+  int bufferSize, numConsumers, bufferWait;
+  bool shareTables;
+
+  // Use of a counter-based random number engine, for which each event is
+  // given its number in the sequence of all runs.
+  bool counterRndm;
+  long nEventsRun;
+
+  // Store of read-only tables shared between the Pythia objects, if any.
+  SharedTablesPtr sharedTablesPtr;
+
+  // Reader of a Les Houches Event File shared between the Pythia objects,
+  // and whether each object uses it (int rather than bool, since the
+  // entries are set from different threads, with -1 during initialization
+  // if customInit changed the input).
+  LHEFDispatcherPtr lhefDispatcherPtr;
+  vector<int> useSharedLHEF;
+
+  // Range of event indices owned by a thread, for the work stealing
+  // scheduler. The owner takes chunks from the front, while idle threads
+  // steal from the back.
+  struct EventRange {
+    mutex rangeMutex;
+    long iBegin = 0, iEnd = 0;
+  };
+
+  // Take the next chunk of events for a thread, stealing from the
+  // busiest other thread if its own range is exhausted.
+  bool nextChunk(vector<EventRange>& ranges, int iThread, long nChunk,
+    long& iBeginChunk, long& iEndChunk);
 
   // Internal Pythia objects.
   vector<unique_ptr<Pythia> > pythiaObjects;
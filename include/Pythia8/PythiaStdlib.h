@@ -12,6 +12,7 @@
 
 // Stdlib header files for mathematics.
 #include <cstddef>
+#include <cstdint>
 #include <cmath>
 #include <cstdlib>
 #include <algorithm>
@@ -45,6 +46,7 @@
 #include <mutex>
 #include <atomic>
 #include <thread>
+#include <condition_variable>
 
 // Define pi if not yet done.
 #ifndef M_PI
@@ -145,6 +147,8 @@ using std::mutex;
 using std::thread;
 using std::atomic;
 using std::lock_guard;
+using std::unique_lock;
+using std::condition_variable;
 
 } // end namespace Pythia8
 
@@ -217,6 +221,29 @@ string toString(double val);
 
 //==========================================================================
 
+// Simple helpers to share out a loop among several threads.
+
+// Number of threads to use, where 0 means one per hardware thread.
+inline int threadCount(int nThreadsIn) {
+  return (nThreadsIn > 0) ? nThreadsIn
+    : max(1, int(thread::hardware_concurrency()));}
+
+// Call fun(iThread, i) for i = 0, ..., n - 1 on at most nThreads threads,
+// where iThread = 0 is the calling thread. Each thread takes the next i
+// until all are done, so the order of the calls is not fixed.
+template<typename Fun> void parallelFor(int n, int nThreads, Fun fun) {
+  atomic<int> iNext(0);
+  auto work = [&](int iThread) {
+    for (int i = iNext++; i < n; i = iNext++) fun(iThread, i);};
+  vector<thread> threads;
+  for (int iThread = 1; iThread < min(nThreads, n); ++iThread)
+    threads.emplace_back(work, iThread);
+  work(0);
+  for (thread& threadNow : threads) threadNow.join();
+}
+
+//==========================================================================
+
 // Print a method name using the appropriate pre-processor macro.
 
 //  The following method was modified from
@@ -217,7 +217,7 @@ public:
     shoveJunctionStrings(),
     shoveMiniStrings(), shoveGluonLoops(), mStringMin(), limitMom(), rCutOff(),
     gAmplitude(), gExponent(), deltay(), deltat(), tShove(), tInit(),
-    showerCut(), alwaysHighest() {}
+    showerCut(), alwaysHighest(), useGrid(), nThreads() {}
 
   // The Ropewalk init function sets parameters and pointers.
   virtual bool init();
@@ -250,6 +250,17 @@ public:
 
 private:
 
+  // The push of the excitations j and k of a rapidity slice on each other.
+  struct RopePush {
+    int j, k;
+    double dpx, dpy;
+  };
+
+  // Find the pushes between the excitation pairs of a rapidity slice,
+  // using a transverse grid.
+  void slicePushes(double y, const vector<RopeDipole*>& dips, double rt,
+    vector<RopePush>& pushes);
+
   // Parameters of the ropewalk.
   double r0, m0, pTcut;
   // Include junction strings in shoving.
@@ -278,6 +289,10 @@ private:
   double showerCut;
   // Assume we are always in highest multiplet.
   bool alwaysHighest;
+  // Use a transverse grid to find the shoving pairs, and the number of
+  // threads for the overlaps and for the shoving with the grid.
+  bool useGrid;
+  int nThreads;
 
   // All dipoles in the event sorted by event record.
   // Index of the two partons.
@@ -305,23 +320,37 @@ class RopeFragPars : public PhysicsBase {
 
 public:
 
+  // The effective values of the fragmentation parameters.
+  struct EffectivePars {
+    double sigma, aLund, aExtraDiquark, bLund, probStoUD, probSQtoQQ,
+      probQQ1toQQ0, probQQtoQ, kappa;
+  };
+
   // Constructor.
   RopeFragPars() : aIn(), adiqIn(), bIn(), rhoIn(), xIn(),
     yIn(), xiIn(), sigmaIn(), kappaIn(), aEff(), adiqEff(), bEff(),
     rhoEff(), xEff(), yEff(), xiEff(), sigmaEff(), kappaEff(),
-    beta() {}
+    beta(), doTable() {}
 
   // The init function sets up initial parameters from settings.
   bool init();
 
-  // Return parameters at given string tension, ordered by their
-  // name for easy insertion in settings.
-  map<string,double> getEffectiveParameters(double h);
+  // Return parameters at given string tension.
+  EffectivePars getEffectiveParameters(double h);
 
 private:
 
   // Constants: can only be changed in the code itself.
-  static const double DELTAA, ACONV, ZCUT;
+  static const double DELTAA, ACONV, ZCUT, DHTABLE, HTABLEMAX;
+
+  // The current effective parameters as a set.
+  EffectivePars currentParameters() const {
+    EffectivePars p = {sigmaEff, aEff, adiqEff, bEff, rhoEff, xEff, yEff,
+      xiEff, kappaEff};
+    return p;}
+
+  // Return a node of the table of parameters, calculated when first needed.
+  const EffectivePars& tableNode(int iNode);
 
   // Get the Fragmentation function a parameter from cache or calculate it.
   double getEffectiveA(double thisb, double mT2, bool isDiquark);
@@ -345,7 +374,7 @@ private:
   double trapIntegrate(double a, double b, double mT2, double sOld, int n);
 
   // Parameter caches to re-use calculations. Sets of parameters, ordered in h.
-  map<double, map<string, double> > parameters;
+  map<double, EffectivePars> parameters;
 
   // Values of the a-parameter ordered in b*mT2 grid.
   map<double, double> aMap;
@@ -362,6 +391,12 @@ private:
   // Junction parameter.
   double beta;
 
+  // Optionally a table of parameters in equidistant steps of h from unity,
+  // to interpolate in, and which of its nodes have been calculated.
+  bool doTable;
+  vector<EffectivePars> table;
+  vector<bool> hasNode;
+
 };
 
 //==================================================================
@@ -377,7 +412,10 @@ public:
 
   // Constructor.
   FlavourRope(Ropewalk & rwIn) : rwPtr(&rwIn), ePtr(), doBuffon(),
-              rapiditySpan(), stringProtonRatio(), fixedKappa(), h() {}
+              rapiditySpan(), stringProtonRatio(), fixedKappa(), h(),
+              sigmaPtr(), aLundPtr(), aExtraDiquarkPtr(), bLundPtr(),
+              probStoUDPtr(), probSQtoQQPtr(), probQQ1toQQ0Ptr(),
+              probQQtoQPtr(), deriveBLundPtr() {}
 
   // Initialize. Set pointers.
   virtual bool init() override {
@@ -389,6 +427,16 @@ public:
     doBuffon = flag("Ropewalk:doBuffon");
     rapiditySpan = parm("Ropewalk:rapiditySpan");
     stringProtonRatio = parm("Ropewalk:stringProtonRatio");
+    // Settings whose allowed ranges limit the effective parameters.
+    sigmaPtr         = settingsPtr->parmPtr("StringPT:sigma");
+    aLundPtr         = settingsPtr->parmPtr("StringZ:aLund");
+    aExtraDiquarkPtr = settingsPtr->parmPtr("StringZ:aExtraDiquark");
+    bLundPtr         = settingsPtr->parmPtr("StringZ:bLund");
+    probStoUDPtr     = settingsPtr->parmPtr("StringFlav:probStoUD");
+    probSQtoQQPtr    = settingsPtr->parmPtr("StringFlav:probSQtoQQ");
+    probQQ1toQQ0Ptr  = settingsPtr->parmPtr("StringFlav:probQQ1toQQ0");
+    probQQtoQPtr     = settingsPtr->parmPtr("StringFlav:probQQtoQ");
+    deriveBLundPtr   = settingsPtr->flagPtr("StringZ:deriveBLund");
     // Initialize FragPar.
     fp.init();
     return true;
@@ -418,11 +466,11 @@ private:
 
   // Find breakup placement and fetch effective parameters.
   // For model depending on vertex information.
-  map<string, double> fetchParameters(double m2Had, vector<int> iParton,
-    int endId);
+  RopeFragPars::EffectivePars fetchParameters(double m2Had,
+    vector<int> iParton, int endId);
   // For simple Buffon model.
-  map<string, double> fetchParametersBuffon(double m2Had, vector<int> iParton,
-    int endId);
+  RopeFragPars::EffectivePars fetchParametersBuffon(double m2Had,
+    vector<int> iParton, int endId);
 
   // Pointer to the ropewalk object.
   Ropewalk* rwPtr;
@@ -448,6 +496,19 @@ private:
   // Locally stored string tension.
   double h;
 
+  // Settings of the fragmentation parameters, for their allowed ranges.
+  const Parm *sigmaPtr, *aLundPtr, *aExtraDiquarkPtr, *bLundPtr,
+    *probStoUDPtr, *probSQtoQQPtr, *probQQ1toQQ0Ptr, *probQQtoQPtr;
+  // Whether bLund is still to be derived from the average z.
+  const Flag* deriveBLundPtr;
+
+  // Limit a value to the allowed range of a setting.
+  static double limited(const Parm* parmPtrIn, double val) {
+    if (parmPtrIn == nullptr) return val;
+    if (parmPtrIn->hasMin) val = max(val, parmPtrIn->valMin);
+    if (parmPtrIn->hasMax) val = min(val, parmPtrIn->valMax);
+    return val;}
+
 };
 
 //==========================================================================
@@ -22,6 +22,10 @@
 
 namespace Pythia8 {
 
+// Forward references to the binary snapshot classes.
+class SnapshotWriter;
+class SnapshotReader;
+
 //==========================================================================
 
 // Class for bool flags.
@@ -197,8 +201,8 @@ class Settings {
 public:
 
   // Constructor.
-  Settings() : loggerPtr(), isInit(false), readingFailedSave(false),
-    lineSaved(false) {}
+  Settings() : loggerPtr(), countLookupsSave(false), isInit(false),
+    readingFailedSave(false), lineSaved(false) {}
 
   // Initialize Logger pointer.
   void initPtrs(Logger* loggerPtrIn) {loggerPtr = loggerPtrIn;}
@@ -224,6 +228,10 @@ public:
   bool writeFile(ostream& os = cout, bool writeAll = false) ;
   bool writeFileXML(ostream& os = cout) ;
 
+  // Write the full database to, or replace it from, a binary snapshot.
+  void writeSnapshot(SnapshotWriter& writer) const;
+  bool readSnapshot(SnapshotReader& reader);
+
   // Print out table of database, either all or only changed ones,
   // or ones containing a given string.
   void listAll() { list( true, false, " "); }
@@ -296,6 +304,24 @@ public:
   vector<double> pvec(string keyIn);
   vector<string> wvec(string keyIn);
 
+  // Give back pointer to entry, with check that key exists, for fast
+  // repeated access to the current value without any name lookup. The
+  // pointer stays valid until the database is reinitialized.
+  const Flag* flagPtr(string keyIn);
+  const Mode* modePtr(string keyIn);
+  const Parm* parmPtr(string keyIn);
+  const Word* wordPtr(string keyIn);
+  const FVec* fvecPtr(string keyIn);
+  const MVec* mvecPtr(string keyIn);
+  const PVec* pvecPtr(string keyIn);
+  const WVec* wvecPtr(string keyIn);
+
+  // Optionally count the number of lookups by name of each entry, e.g. to
+  // find places where repeated lookups should be replaced by pointers.
+  void countLookups(bool countIn) {countLookupsSave = countIn;
+    lookupCountsSave.clear();}
+  map<string, long> getLookupCounts() const {return lookupCountsSave;}
+
   // Give back default value, with check that key exists.
   bool   flagDefault(string keyIn);
   int    modeDefault(string keyIn);
@@ -387,6 +413,10 @@ public:
   // Set of loaded plugin libraries.
   set<string> pluginLibraries;
 
+  // Counting of lookups by name.
+  bool countLookupsSave;
+  map<string, long> lookupCountsSave;
+
   // Flags that initialization has been performed; whether any failures.
   bool isInit, readingFailedSave;
 
@@ -49,6 +49,9 @@ typedef shared_ptr<LHAup> LHAupPtr;
 class LHEF3FromPythia8;
 typedef shared_ptr<LHEF3FromPythia8> LHEF3FromPythia8Ptr;
 
+class LHEFDispatcher;
+typedef shared_ptr<LHEFDispatcher> LHEFDispatcherPtr;
+
 class Merging;
 typedef shared_ptr<Merging> MergingPtr;
 
@@ -73,6 +76,9 @@ typedef shared_ptr<ResonanceWidths> ResonanceWidthsPtr;
 class RndmEngine;
 typedef shared_ptr<RndmEngine> RndmEnginePtr;
 
+class SharedTables;
+typedef shared_ptr<SharedTables> SharedTablesPtr;
+
 class ShowerModel;
 typedef shared_ptr<ShowerModel> ShowerModelPtr;
 
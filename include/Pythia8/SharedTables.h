@@ -0,0 +1,159 @@
+// SharedTables.h is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// This file contains a store of read-only data tables that can be shared
+// between several Pythia instances, e.g. those of PythiaParallel.
+// SharedTables: thread-safe store of tables, identified by a string key.
+// CopyOnWrite: tables of an object that may be shared with other objects.
+
+#ifndef Pythia8_SharedTables_H
+#define Pythia8_SharedTables_H
+
+#include "Pythia8/PythiaStdlib.h"
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// The SharedTables class keeps one copy of data tables that are expensive
+// to set up, such as PDF grids, hadron widths and MPI initialization data,
+// so that several Pythia objects with the same setup can use them without
+// reading or calculating them again. Tables are immutable once stored;
+// an object that wants to modify a table must make its own copy first.
+// The key should identify both the kind of table and its input, e.g.
+// the class name and the file it was read from.
+
+class SharedTables {
+
+public:
+
+  // Constructor.
+  SharedTables() : tablesMutex(), tables(), nCreatedSave(0), nReusedSave(0) {}
+
+  // Return the table with the given key. If it does not exist, it is
+  // created by calling the create function, at most once per key. Other
+  // threads asking for the same table wait until it has been created,
+  // while tables with other keys can be created at the same time.
+  // If the create function returns a null pointer nothing is stored.
+  // The create function must not itself access the store.
+  template<class T> shared_ptr<const T> get(string key,
+    function<shared_ptr<const T>()> create) {
+    shared_ptr<Entry> entryPtr = entry(key, true);
+    lock_guard<mutex> lock(entryPtr->entryMutex);
+    if (entryPtr->tablePtr) {
+      ++nReusedSave;
+      return std::static_pointer_cast<const T>(entryPtr->tablePtr);
+    }
+    shared_ptr<const T> tablePtr = create();
+    if (tablePtr) {
+      entryPtr->tablePtr = tablePtr;
+      ++nCreatedSave;
+    }
+    return tablePtr;
+  }
+
+  // Return the table with the given key, or a null pointer if not found.
+  // Waits if the table is being created by another thread.
+  template<class T> shared_ptr<const T> find(string key) {
+    shared_ptr<Entry> entryPtr = entry(key, false);
+    if (!entryPtr) return nullptr;
+    lock_guard<mutex> lock(entryPtr->entryMutex);
+    if (!entryPtr->tablePtr) return nullptr;
+    ++nReusedSave;
+    return std::static_pointer_cast<const T>(entryPtr->tablePtr);
+  }
+
+  // Store a table with the given key, unless one already exists.
+  template<class T> void insert(string key, shared_ptr<const T> tablePtr) {
+    if (!tablePtr) return;
+    shared_ptr<Entry> entryPtr = entry(key, true);
+    lock_guard<mutex> lock(entryPtr->entryMutex);
+    if (!entryPtr->tablePtr) {
+      entryPtr->tablePtr = tablePtr;
+      ++nCreatedSave;
+    }
+  }
+
+  // Number of stored tables, and number of times a table was reused.
+  int nCreated() {return nCreatedSave;}
+  int nReused()  {return nReusedSave;}
+
+  // Remove all tables. Objects using them keep their own references.
+  void clear() {lock_guard<mutex> lock(tablesMutex); tables.clear();}
+
+private:
+
+  // A table together with the lock that guards its creation.
+  struct Entry {
+    mutex entryMutex;
+    shared_ptr<const void> tablePtr;
+  };
+
+  // Find the entry with the given key, optionally adding an empty one.
+  // The store lock is only held for the lookup, not during creation.
+  shared_ptr<Entry> entry(const string& key, bool add) {
+    lock_guard<mutex> lock(tablesMutex);
+    auto iter = tables.find(key);
+    if (iter != tables.end()) return iter->second;
+    if (!add) return nullptr;
+    shared_ptr<Entry> entryPtr = make_shared<Entry>();
+    tables[key] = entryPtr;
+    return entryPtr;
+  }
+
+  // Lock for thread-safe access to the map of entries.
+  mutex tablesMutex;
+
+  // The stored tables.
+  map<string, shared_ptr<Entry> > tables;
+
+  // Statistics.
+  atomic<int> nCreatedSave, nReusedSave;
+
+};
+
+//==========================================================================
+
+// The CopyOnWrite class holds the tables of an object, which may either
+// be owned by the object or be shared with other objects through the
+// SharedTables store. Tables are only read through the pointer syntax;
+// a writable reference first makes a private copy of shared tables.
+
+template<class T> class CopyOnWrite {
+
+public:
+
+  // Constructor. Starts out with empty tables owned by the object.
+  CopyOnWrite() : ownPtr(make_shared<T>()), tablePtr(ownPtr) {}
+
+  // Read-only access to the tables in use.
+  const T* operator->() const {return tablePtr.get();}
+  const T& operator*()  const {return *tablePtr;}
+
+  // Tables that can be modified, copying shared tables if necessary.
+  T& writable() { if (!ownPtr) {
+    ownPtr = make_shared<T>(*tablePtr); tablePtr = ownPtr;}
+    return *ownPtr; }
+
+  // Hand over the tables for sharing. They are no longer modified here.
+  shared_ptr<const T> share() {ownPtr = nullptr; return tablePtr;}
+
+  // Use tables shared by another object.
+  void use(shared_ptr<const T> tablePtrIn) {
+    ownPtr = nullptr; tablePtr = tablePtrIn;}
+
+private:
+
+  // Tables owned by this object, if any, and the tables currently in use.
+  shared_ptr<T> ownPtr;
+  shared_ptr<const T> tablePtr;
+
+};
+
+//==========================================================================
+
+} // end namespace Pythia8
+
+#endif // Pythia8_SharedTables_H
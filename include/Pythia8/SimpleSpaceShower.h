@@ -229,6 +229,11 @@ private:
   int iDipSel;
   SpaceDipoleEnd* dipEndSel;
 
+  // As pTnext with dipole ends and event as input, but working directly
+  // on them, so that repeated trials need not copy them.
+  double pTnextTrial( vector<SpaceDipoleEnd>& dipEnds, Event& event,
+    double pTbegAll, double pTendAll, double m2dip, double s, double x);
+
   // Evolve a QCD dipole end.
   void pT2nextQCD( double pT2begDip, double pT2endDip);
 
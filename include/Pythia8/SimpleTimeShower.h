@@ -73,6 +73,30 @@ public:
   // Pointer to an onium emission object, if present.
   shared_ptr<SplitOnia> emissionPtr{};
 
+  // Trial emission kept from an earlier evolution step, with the dipole
+  // properties, the pT2 range it was generated for and its splitting name.
+  bool   hasTrial{false};
+  int    iRadTrial{-1}, iRecTrial{-1}, systemTrial{-1}, colTypeTrial{0},
+         MEtypeTrial{0};
+  double mRadTrial{0.}, mRecTrial{0.}, mDipTrial{0.}, pT2TrialBeg{0.},
+         pT2TrialEnd{0.};
+  string splittingNameTrial{};
+
+  // Store the current trial emission, generated from pT2beg down to pT2end.
+  void saveTrial(double pT2beg, double pT2end, const string& nameIn) {
+    hasTrial = true; iRadTrial = iRadiator; iRecTrial = iRecoiler;
+    systemTrial = system; colTypeTrial = colType; MEtypeTrial = MEtype;
+    mRadTrial = mRad; mRecTrial = mRec; mDipTrial = mDip;
+    pT2TrialBeg = pT2beg; pT2TrialEnd = pT2end; splittingNameTrial = nameIn;}
+
+  // Check that the stored trial emission is valid below pT2beg, i.e. that
+  // the dipole is unchanged and the trial is below the new starting scale.
+  bool hasValidTrial(double pT2beg) const {return hasTrial
+    && iRadiator == iRadTrial && iRecoiler == iRecTrial
+    && system == systemTrial && colType == colTypeTrial
+    && MEtype == MEtypeTrial && mRad == mRadTrial && mRec == mRecTrial
+    && mDip == mDipTrial && pT2beg <= pT2TrialBeg && pT2 < pT2beg;}
+
 };
 
 //==========================================================================
@@ -110,9 +134,9 @@ public:
     vetoWeakDeltaR2(), twoHard(), dopTlimit1(), dopTlimit2(), dopTdamp(),
     pT2damp(), kRad(), kEmt(), pdfScale2(), doTrialNow(), canEnhanceEmission(),
     canEnhanceTrial(), canEnhanceET(), doUncertaintiesNow(), dipSel(),
-    iDipSel(), nHard(), nFinalBorn(), nMaxGlobalBranch(), nGlobal(),
-    globalRecoilMode(), limitMUQ(), weakHardSize() { beamOffset = 0;
-    pdfMode = 0; useSystems = true; }
+    iDipSel(), reuseTrials(), selBranched(), nHard(), nFinalBorn(),
+    nMaxGlobalBranch(), nGlobal(), globalRecoilMode(), limitMUQ(),
+    weakHardSize() { beamOffset = 0; pdfMode = 0; useSystems = true; }
 
   // Destructor.
   virtual ~SimpleTimeShower() override {}
@@ -268,6 +292,13 @@ private:
   TimeDipoleEnd* dipSel;
   int iDipSel;
 
+  // Reuse trial emissions of unchanged QCD dipole ends between steps.
+  // Only done when the previously selected emission was also performed.
+  // Dipole ends, with starting scales, where no trial emission was found
+  // above the lower end of the stored range.
+  bool reuseTrials, selBranched;
+  vector< pair<int,double> > dipNoTrial;
+
   // Setup a dipole end, either QCD, QED/photon, weak or Hidden Valley one.
   void setupQCDdip( int iSys, int i, int colTag,  int colSign, Event& event,
     bool isOctetOnium = false, bool limitPTmaxIn = true);
@@ -287,6 +318,11 @@ private:
   // Special setup for onium.
   void regenerateOniumDipoles(Event & event);
 
+  // As pTnext with dipole ends and event as input, but working directly
+  // on them, so that repeated trials need not copy them.
+  double pTnextTrial( vector<TimeDipoleEnd>& dipEnds, Event& event,
+    double pTbegAll, double pTendAll);
+
   // Evolve a QCD dipole end.
   void pT2nextQCD( double pT2begDip, double pT2sel, TimeDipoleEnd& dip,
     Event& event);
@@ -361,6 +397,12 @@ private:
   vector<int> weak2to2lines;
   int weakHardSize;
 
+  // Handles to settings that are read during the evolution, since they
+  // may be changed between events, e.g. by merging.
+  const Flag* setScalesFromLHEFPtr{};
+  const Flag* setDipScalesFromLHEFPtr{};
+  const Mode* nPartonsInBornPtr{};
+
   // Settings and member variables for interleaved resonance decays.
   bool doFSRinResonances{};
   int resDecScaleChoice{-1}, iHardResDecSav{}, nRecurseResDec{};
@@ -0,0 +1,189 @@
+// Snapshot.h is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// This file contains classes for binary snapshots of the Settings and
+// ParticleData databases, which allow a Pythia object to be constructed
+// without parsing the XML files.
+// SnapshotWriter: collects the contents of a snapshot in memory.
+// SnapshotReader: reads back the contents, with checks against overrun.
+// Snapshot: a snapshot file, mapped into memory and verified.
+
+#ifndef Pythia8_Snapshot_H
+#define Pythia8_Snapshot_H
+
+#include "Pythia8/Logger.h"
+#include "Pythia8/PythiaStdlib.h"
+#include <cstdint>
+#include <cstring>
+
+namespace Pythia8 {
+
+// Forward references to the databases stored in a snapshot.
+class Settings;
+class ParticleData;
+
+//==========================================================================
+
+// The SnapshotWriter class appends values to a binary buffer. Integers
+// are stored as 32 bits, strings and vectors with their length first.
+
+class SnapshotWriter {
+
+public:
+
+  // Append a single value.
+  void put(bool val) {dataSave.push_back(val ? 1 : 0);}
+  void put(int val) {int32_t tmp = val; putBytes(&tmp, sizeof(tmp));}
+  void put(double val) {putBytes(&val, sizeof(val));}
+  void put(const string& val) {put(int(val.size()));
+    dataSave.append(val);}
+
+  // Append a vector of values.
+  template<typename T> void put(const vector<T>& val) {
+    put(int(val.size())); for (const T& v : val) put(v);}
+
+  // The collected contents.
+  const string& data() const {return dataSave;}
+
+private:
+
+  // The contents.
+  string dataSave;
+
+  // Append raw bytes.
+  void putBytes(const void* src, size_t n) {
+    dataSave.append(static_cast<const char*>(src), n);}
+
+};
+
+//==========================================================================
+
+// The SnapshotReader class reads back values in the order they were
+// written. Reading beyond the end marks the reader as bad, after which
+// all further reads fail.
+
+class SnapshotReader {
+
+public:
+
+  // Constructor.
+  SnapshotReader(const char* begIn, const char* endIn) : ptr(begIn),
+    endPtr(endIn), isGoodSave(true) {}
+
+  // Read a single value.
+  bool get(bool& val) {
+    char tmp = 0;
+    if (!getBytes(&tmp, 1)) return false;
+    val = (tmp != 0);
+    return true;
+  }
+  bool get(int& val) {
+    int32_t tmp = 0;
+    if (!getBytes(&tmp, sizeof(tmp))) return false;
+    val = tmp;
+    return true;
+  }
+  bool get(double& val) {return getBytes(&val, sizeof(val));}
+  bool get(string& val) {
+    int n = 0;
+    if (!get(n) || n < 0 || n > endPtr - ptr) return fail();
+    val.assign(ptr, n);
+    ptr += n;
+    return true;
+  }
+
+  // Read a vector of values.
+  template<typename T> bool get(vector<T>& val) {
+    int n = 0;
+    if (!get(n) || n < 0 || n > endPtr - ptr) return fail();
+    val.resize(n);
+    for (int i = 0; i < n; ++i) {
+      T tmp;
+      if (!get(tmp)) return false;
+      val[i] = tmp;
+    }
+    return true;
+  }
+
+  // Check status, and whether all contents have been read.
+  bool isGood() const {return isGoodSave;}
+  bool atEnd() const {return ptr == endPtr;}
+
+private:
+
+  // Current position and end of the contents; whether reading succeeded.
+  const char *ptr, *endPtr;
+  bool isGoodSave;
+
+  // Read raw bytes.
+  bool getBytes(void* dest, size_t n) {
+    if (!isGoodSave || size_t(endPtr - ptr) < n) return fail();
+    memcpy(dest, ptr, n); ptr += n; return true;}
+  bool fail() {isGoodSave = false; return false;}
+
+};
+
+//==========================================================================
+
+// The Snapshot class holds a snapshot file of fully constructed Settings
+// and ParticleData databases. The file is mapped into memory, and its
+// format version and checksum are verified when it is opened. A single
+// Snapshot may be used to construct any number of Pythia objects.
+
+class Snapshot {
+
+public:
+
+  // Constructors.
+  Snapshot(Logger* loggerPtrIn = nullptr) : loggerPtr(loggerPtrIn),
+    dataPtr(nullptr), dataSize(0) {}
+  Snapshot(string fileName, Logger* loggerPtrIn = nullptr)
+    : loggerPtr(loggerPtrIn), dataPtr(nullptr), dataSize(0) {open(fileName);}
+
+  // Destructor. Releases the file.
+  ~Snapshot() {close();}
+
+  // The mapped file cannot be copied.
+  Snapshot(const Snapshot&) = delete;
+  Snapshot& operator=(const Snapshot&) = delete;
+
+  // Open and verify a snapshot file. Release the file.
+  bool open(string fileName);
+  void close();
+
+  // Check whether a valid snapshot is available.
+  bool isOpen() const {return dataPtr != nullptr;}
+
+  // Fill the databases from the snapshot. Pointers are not touched.
+  bool load(Settings& settings, ParticleData& particleData) const;
+
+  // Write a snapshot of the databases to file.
+  static bool write(string fileName, const Settings& settings,
+    const ParticleData& particleData, Logger* loggerPtrIn = nullptr);
+
+private:
+
+  // Constants: could only be changed in the code itself.
+  static const char     MAGIC[8];
+  static const uint32_t VERSION, BYTEORDER;
+  static const size_t   HEADERSIZE;
+
+  // Pointer to logger for error messages, if any.
+  Logger* loggerPtr;
+
+  // The mapped file contents.
+  const char* dataPtr;
+  size_t      dataSize;
+
+  // Checksum of the contents after the header.
+  static uint64_t checksum(const char* begIn, size_t nIn);
+
+};
+
+//==========================================================================
+
+} // end namespace Pythia8
+
+#endif // Pythia8_Snapshot_H
@@ -421,6 +421,9 @@ public:
   // File Name (can be either SLHA or LHEF)
   string slhaFile;
 
+  // All non-comment lines read so far, to identify the spectrum.
+  const string& contents() const {return contentsSav;}
+
   // Class for SLHA data entry
   class Entry {
 
@@ -646,6 +649,7 @@ private:
   int verboseSav;
   bool headerPrinted, footerPrinted, filePrinted;
   bool slhaRead, lhefRead, lhefSlha, useDecay;
+  string contentsSav;
 
 };
 
@@ -760,6 +760,10 @@ public:
   // Return a flat random number.
   double flat() {return rndm.get_next_float();}
 
+  // Fill a buffer with flat random numbers, without a virtual call each.
+  void flatBlock(double* buffer, int n) {
+    for (int i = 0; i < n; ++i) buffer[i] = rndm.get_next_float();}
+
   // Note: The member(s) below have been made public to ease the generation
   // of Python bindings.
   // protected:
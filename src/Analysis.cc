@@ -3,7 +3,7 @@
 // PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
 // Please respect the MCnet Guidelines, see GUIDELINES for details.
 
-// Function definitions (not found in the header) for the
+// Function definitions (not found in the header) for the FinalStateArrays,
 // Sphericity, Thrust, ClusJet, CellJet and SlowJet classes.
 
 #include "Pythia8/Analysis.h"
@@ -13,6 +13,65 @@ namespace Pythia8 {
 
 //==========================================================================
 
+// FinalStateArrays class.
+// This class stores the final-state particles as contiguous arrays.
+
+//--------------------------------------------------------------------------
+
+// Constants: could be changed here if desired, but normally should not.
+
+// Small number to avoid division by zero, as in Particle::eta().
+const double FinalStateArrays::TINY = 1e-20;
+
+//--------------------------------------------------------------------------
+
+// Extract the final-state particles of an event.
+
+void FinalStateArrays::fill(const Event& event) {
+
+  // Reset arrays, but keep their capacity for the next event.
+  pxSave.clear();
+  pySave.clear();
+  pzSave.clear();
+  eSave.clear();
+  mSave.clear();
+  chargeSave.clear();
+  idSave.clear();
+  statusSave.clear();
+  indexSave.clear();
+  visibleSave.clear();
+
+  // Copy the properties of all final-state particles.
+  for (int i = 0; i < event.size(); ++i) {
+    const Particle& pNow = event[i];
+    if (!pNow.isFinal()) continue;
+    pxSave.push_back( pNow.px() );
+    pySave.push_back( pNow.py() );
+    pzSave.push_back( pNow.pz() );
+    eSave.push_back( pNow.e() );
+    mSave.push_back( pNow.m() );
+    chargeSave.push_back( pNow.charge() );
+    idSave.push_back( pNow.id() );
+    statusSave.push_back( pNow.status() );
+    indexSave.push_back( i );
+    visibleSave.push_back( pNow.isVisible() ? 1 : 0 );
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Pseudorapidity of particle i, with the same definition as for Particle.
+
+double FinalStateArrays::eta(int i) const {
+  double pT2Now = pxSave[i] * pxSave[i] + pySave[i] * pySave[i];
+  double pAbs   = sqrt(pT2Now + pzSave[i] * pzSave[i]);
+  double temp   = log( (pAbs + abs(pzSave[i])) / max( TINY, sqrt(pT2Now) ) );
+  return (pzSave[i] > 0.) ? temp : -temp;
+}
+
+//==========================================================================
+
 // Sphericity class.
 // This class finds sphericity-related properties of an event.
 
@@ -69,6 +128,61 @@ bool Sphericity::analyze(const Event& event) {
     denom += pWeight * p2Now;
   }
 
+  // Find eigenvalues and eigenvectors.
+  return diagonalize( tt, denom, nStudy);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Analyze the final state stored as contiguous arrays.
+
+bool Sphericity::analyze(const FinalStateArrays& fs) {
+
+  // Initial values, tensor and counters zero.
+  eVal1 = eVal2 = eVal3 = 0.;
+  eVec1 = eVec2 = eVec3 = 0.;
+  double tt[4][4];
+  for (int j = 1; j < 4; ++j)
+  for (int k = j; k < 4; ++k) tt[j][k] = 0.;
+  int nStudy = 0;
+  double denom = 0.;
+
+  // Loop over all particles, reading the momentum arrays directly.
+  // Particles that are not selected get zero weight.
+  const double* px = fs.px().data();
+  const double* py = fs.py().data();
+  const double* pz = fs.pz().data();
+  int nFS = fs.size();
+  for (int i = 0; i < nFS; ++i) {
+    double keepNow = fs.keep( select, i);
+    nStudy += int(keepNow);
+
+    // Calculate matrix to be diagonalized. Special cases for speed.
+    double p2Now = px[i] * px[i] + py[i] * py[i] + pz[i] * pz[i];
+    double pWeight = keepNow;
+    if (powerInt == 1) pWeight *= 1. / sqrt(max(P2MIN, p2Now));
+    else if (powerInt == 0) pWeight *= pow( max(P2MIN, p2Now), powerMod);
+    tt[1][1] += pWeight * px[i] * px[i];
+    tt[1][2] += pWeight * px[i] * py[i];
+    tt[1][3] += pWeight * px[i] * pz[i];
+    tt[2][2] += pWeight * py[i] * py[i];
+    tt[2][3] += pWeight * py[i] * pz[i];
+    tt[3][3] += pWeight * pz[i] * pz[i];
+    denom += pWeight * p2Now;
+  }
+
+  // Find eigenvalues and eigenvectors.
+  return diagonalize( tt, denom, nStudy);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find eigenvalues and eigenvectors of the summed momentum tensor.
+
+bool Sphericity::diagonalize(double tt[4][4], double denom, int nStudy) {
+
   // Very low multiplicities (0 or 1) not considered.
   if (nStudy < NSTUDYMIN) {
     if (nFew < TIMESTOPRINT) cout << " PYTHIA Error in "
@@ -232,16 +346,14 @@ bool Thrust::analyze(const Event& event) {
   // Initial values and counters zero.
   eVal1 = eVal2 = eVal3 = 0.;
   eVec1 = eVec2 = eVec3 = 0.;
-  int nStudy = 0;
   vector<Vec4> pOrder;
-  Vec4 pSum, nRef, pPart, pFull, pMax;
+  Vec4 pSum;
 
   // Loop over desired particles in the event.
   for (int i = 0; i < event.size(); ++i)
   if (event[i].isFinal()) {
     if (select >  2 &&  event[i].isNeutral() ) continue;
     if (select == 2 && !event[i].isVisible() ) continue;
-    ++nStudy;
 
     // Store momenta. Use energy component for absolute momentum.
     Vec4 pNow = event[i].p();
@@ -250,7 +362,59 @@ bool Thrust::analyze(const Event& event) {
     pOrder.push_back(pNow);
   }
 
+  // Find the thrust, major and minor axes.
+  return findAxes( pOrder, pSum);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Analyze the final state stored as contiguous arrays.
+
+bool Thrust::analyze(const FinalStateArrays& fs) {
+
+  // Initial values and counters zero.
+  eVal1 = eVal2 = eVal3 = 0.;
+  eVec1 = eVec2 = eVec3 = 0.;
+  vector<Vec4> pOrder;
+  pOrder.reserve(fs.size());
+  Vec4 pSum;
+
+  // Loop over all particles, reading the momentum arrays directly.
+  // Each momentum is written to the next free slot, which is only
+  // advanced for selected particles.
+  const double* px = fs.px().data();
+  const double* py = fs.py().data();
+  const double* pz = fs.pz().data();
+  int nFS = fs.size();
+  pOrder.resize(nFS);
+  int nSel = 0;
+  for (int i = 0; i < nFS; ++i) {
+    double keepNow = fs.keep( select, i);
+
+    // Store momenta. Use energy component for absolute momentum.
+    Vec4 pNow( px[i], py[i], pz[i], 0.);
+    pNow.e(pNow.pAbs());
+    pSum += keepNow * pNow;
+    pOrder[nSel] = pNow;
+    nSel += int(keepNow);
+  }
+  pOrder.resize(nSel);
+
+  // Find the thrust, major and minor axes.
+  return findAxes( pOrder, pSum);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find the thrust, major and minor axes from the selected momenta.
+
+bool Thrust::findAxes(vector<Vec4>& pOrder, const Vec4& pSum) {
+
   // Very low multiplicities (0 or 1) not considered.
+  int nStudy = pOrder.size();
+  Vec4 nRef, pPart, pFull, pMax;
   if (nStudy < NSTUDYMIN) {
     if (nFew < TIMESTOPRINT) cout << " PYTHIA Error in "
       << "Thrust::analyze: too few particles" << endl;
@@ -459,6 +623,66 @@ bool ClusterJet::analyze(const Event& event, double yScaleIn,
     pSum += pTemp;
   }
 
+  // Do the clustering.
+  return cluster( pSum);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Analyze the final state stored as contiguous arrays.
+
+bool ClusterJet::analyze(const FinalStateArrays& fs, double yScaleIn,
+  double pTscaleIn, int nJetMinIn, int nJetMaxIn) {
+
+  // Input values. Initial values zero.
+  yScale  = yScaleIn;
+  pTscale = pTscaleIn;
+  nJetMin = nJetMinIn;
+  nJetMax = nJetMaxIn;
+  particles.resize(0);
+  jets.resize(0);
+  Vec4 pSum;
+  distances.clear();
+
+  // Loop over desired particles, reading the arrays directly.
+  const double* px = fs.px().data();
+  const double* py = fs.py().data();
+  const double* pz = fs.pz().data();
+  const double* e  = fs.e().data();
+  const int*    id = fs.id().data();
+  const int*    index = fs.index().data();
+  int nFS = fs.size();
+  particles.resize(nFS);
+  int nSel = 0;
+  for (int i = 0; i < nFS; ++i) {
+    double keepNow = fs.keep( select, i);
+
+    // Store them, possibly with modified mass => new energy. The next
+    // free slot is only advanced for selected particles.
+    Vec4 pTemp( px[i], py[i], pz[i], e[i]);
+    if (massSet == 0 || massSet == 1) {
+      double mTemp = (massSet == 0 || id[i] == 22) ? 0. : PIMASS;
+      double eTemp = sqrt(pTemp.pAbs2() + pow2(mTemp));
+      pTemp.e(eTemp);
+    }
+    particles[nSel] = SingleClusterJet(pTemp, index[i]);
+    pSum += keepNow * pTemp;
+    nSel += int(keepNow);
+  }
+  particles.resize(nSel);
+
+  // Do the clustering.
+  return cluster( pSum);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Cluster the selected particles into jets.
+
+bool ClusterJet::cluster(const Vec4& pSum) {
+
   // Very low multiplicities not considered.
   nParticles = particles.size();
   if (nParticles < nJetMin) {
@@ -748,28 +972,81 @@ bool CellJet::analyze(const Event& event, double eTjetMinIn,
     if (abs(etaNow) > etaMax) continue;
     double phiNow = event[i].phi();
     double pTnow  = event[i].pT();
-    int iEtaNow   = max(1, min( nEta, 1 + int(nEta * 0.5
-      * (1. + etaNow / etaMax) ) ) );
-    int iPhiNow   = max(1, min( nPhi, 1 + int(nPhi * 0.5
-      * (1. + phiNow / M_PI) ) ) );
-    int iCell     = nPhi * iEtaNow + iPhiNow;
-
-    // Add pT to cell already hit or book a new cell.
-    bool found = false;
-    for (int j = 0; j < int(cells.size()); ++j) {
-      if (iCell == cells[j].iCell) {
-        found = true;
-        ++cells[j].multiplicity;
-        cells[j].eTcell += pTnow;
-        continue;
-      }
-    }
-    if (!found) {
-      double etaCell = (etaMax / nEta) * (2 * iEtaNow - 1 - nEta);
-      double phiCell = (M_PI / nPhi) * (2 * iPhiNow - 1 - nPhi);
-      cells.push_back( SingleCell( iCell, etaCell, phiCell, pTnow, 1) );
+    addToCell( cells, etaNow, phiNow, pTnow);
+  }
+
+  // Find the jets.
+  return findJets( cells);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Analyze the final state stored as contiguous arrays.
+
+bool CellJet::analyze(const FinalStateArrays& fs, double eTjetMinIn,
+  double coneRadiusIn, double eTseedIn) {
+
+  // Input values. Initial values zero.
+  eTjetMin   = eTjetMinIn;
+  coneRadius = coneRadiusIn;
+  eTseed     = eTseedIn;
+  jets.resize(0);
+  vector<SingleCell> cells;
+
+  // Loop over desired particles, reading the arrays directly.
+  int nFS = fs.size();
+  for (int i = 0; i < nFS; ++i) {
+    if (!fs.keep( select, i)) continue;
+
+    // Find particle position in (eta, phi, pT) space.
+    double etaNow = fs.eta(i);
+    if (abs(etaNow) > etaMax) continue;
+    addToCell( cells, etaNow, fs.phi(i), fs.pT(i));
+  }
+
+  // Find the jets.
+  return findJets( cells);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Add the pT of a particle to the cell it hits, or book a new cell.
+
+void CellJet::addToCell(vector<SingleCell>& cells, double etaNow,
+  double phiNow, double pTnow) {
+
+  // Find cell in (eta, phi) space.
+  int iEtaNow   = max(1, min( nEta, 1 + int(nEta * 0.5
+    * (1. + etaNow / etaMax) ) ) );
+  int iPhiNow   = max(1, min( nPhi, 1 + int(nPhi * 0.5
+    * (1. + phiNow / M_PI) ) ) );
+  int iCell     = nPhi * iEtaNow + iPhiNow;
+
+  // Add pT to cell already hit or book a new cell.
+  bool found = false;
+  for (int j = 0; j < int(cells.size()); ++j) {
+    if (iCell == cells[j].iCell) {
+      found = true;
+      ++cells[j].multiplicity;
+      cells[j].eTcell += pTnow;
+      continue;
     }
   }
+  if (!found) {
+    double etaCell = (etaMax / nEta) * (2 * iEtaNow - 1 - nEta);
+    double phiCell = (M_PI / nPhi) * (2 * iPhiNow - 1 - nPhi);
+    cells.push_back( SingleCell( iCell, etaCell, phiCell, pTnow, 1) );
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find the jets from the filled cells.
+
+bool CellJet::findJets(vector<SingleCell>& cells) {
 
   // Smear true bin content by calorimeter resolution.
   if (smear > 0 && rndmPtr != 0)
@@ -925,7 +1202,7 @@ bool SlowJet::setup(const Event& event) {
 
   // Loop over final particles in the event.
   Vec4   pTemp;
-  double mTemp, pT2Temp, mTTemp, yTemp, phiTemp;
+  double mTemp;
   for (int i = 0; i < event.size(); ++i)
   if (event[i].isFinal()) {
 
@@ -956,14 +1233,95 @@ bool SlowJet::setup(const Event& event) {
     }
 
     // Store particle momentum, including some derived quantities.
-    pT2Temp  = max( TINY*TINY, pTemp.pT2());
-    mTTemp  = sqrt( mTemp*mTemp + pT2Temp);
-    yTemp   = (pTemp.pz() > 0)
-            ? log( max( TINY, pTemp.e() + pTemp.pz() ) / mTTemp )
-            : log( mTTemp / max( TINY, pTemp.e() - pTemp.pz() ) );
-    phiTemp = pTemp.phi();
-    clusters.push_back( SingleSlowJet(pTemp, pT2Temp, yTemp, phiTemp, i) );
+    addCluster( pTemp, mTemp, i);
   }
+
+  // Set up initial distances.
+  return setupDistances();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set up list of particles to analyze from the final state stored as
+// contiguous arrays, and initial distances. No SlowJetHook can be used.
+
+bool SlowJet::setup(const FinalStateArrays& fs) {
+
+  // Initial values zero.
+  clusters.resize(0);
+  jets.resize(0);
+  jtSize = 0;
+
+  // The SlowJetHook needs the full event record.
+  if (!noHook) {
+    cout << " PYTHIA Error in SlowJet::setup: "
+         << "a SlowJetHook requires the full event record" << endl;
+    origSize = clSize = 0;
+    return false;
+  }
+
+  // Loop over the stored final particles.
+  const double* px = fs.px().data();
+  const double* py = fs.py().data();
+  const double* pz = fs.pz().data();
+  const double* e  = fs.e().data();
+  const double* m  = fs.m().data();
+  const double* charge = fs.charge().data();
+  const char*   visible = fs.visible().data();
+  const int*    id = fs.id().data();
+  const int*    index = fs.index().data();
+  int nFS = fs.size();
+  clusters.reserve(nFS);
+  Vec4   pTemp;
+  double mTemp;
+  for (int i = 0; i < nFS; ++i) {
+
+    // Apply selection options for visible or charged particles.
+    if      (chargedOnly && charge[i] == 0.) continue;
+    else if (visibleOnly && !visible[i]) continue;
+
+    // Pseudorapidity cut to describe detector range.
+    if (cutInEta && abs(fs.eta(i)) > etaMax) continue;
+
+    // Optionally modify mass and energy.
+    pTemp.p( px[i], py[i], pz[i], e[i]);
+    mTemp = m[i];
+    if (modifyMass) {
+      mTemp = (massSet == 0 || id[i] == 22) ? 0. : PIMASS;
+      pTemp.e( sqrt(pTemp.pAbs2() + mTemp*mTemp) );
+    }
+
+    // Store particle momentum, including some derived quantities.
+    addCluster( pTemp, mTemp, index[i]);
+  }
+
+  // Set up initial distances.
+  return setupDistances();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Store a particle as a new cluster, including some derived quantities.
+
+void SlowJet::addCluster(const Vec4& pTemp, double mTemp, int iEvent) {
+  double pT2Temp = max( TINY*TINY, pTemp.pT2());
+  double mTTemp  = sqrt( mTemp*mTemp + pT2Temp);
+  double yTemp   = (pTemp.pz() > 0)
+                 ? log( max( TINY, pTemp.e() + pTemp.pz() ) / mTTemp )
+                 : log( mTTemp / max( TINY, pTemp.e() - pTemp.pz() ) );
+  double phiTemp = pTemp.phi();
+  clusters.push_back( SingleSlowJet(pTemp, pT2Temp, yTemp, phiTemp,
+    iEvent) );
+}
+
+//--------------------------------------------------------------------------
+
+// Set up the initial distances between the stored clusters.
+
+bool SlowJet::setupDistances() {
+
   origSize = clusters.size();
 
   // Done here for FJcore machinery.
@@ -996,6 +1354,11 @@ bool SlowJet::setup(const Event& event) {
     }
   }
 
+  // Find nearest neighbour of each particle.
+  dRowMin.resize(clSize);
+  jRowMin.resize(clSize);
+  for (int i = 0; i < clSize; ++i) findRowMin(i);
+
   // Find first particle pair to join.
   findNext();
 
@@ -1059,8 +1422,12 @@ bool SlowJet::doStep() {
       if (isAnti)    dijTemp /= max(clusters[i].pT2, clusters[jMin].pT2);
       else if (isKT) dijTemp *= min(clusters[i].pT2, clusters[jMin].pT2);
       if (i < jMin) dij[jMin*(jMin-1)/2 + i] = dijTemp;
-      else          dij[i*(i-1)/2 + jMin]    = dijTemp;
+      else {
+        dij[i*(i-1)/2 + jMin] = dijTemp;
+        updateRowMin( i, jMin);
+      }
     }
+    findRowMin( jMin);
   }
 
   // Move up last cluster and distances to vacated position iMin.
@@ -1069,12 +1436,17 @@ bool SlowJet::doStep() {
     diB[iMin] = diB[clLast];
     for (int j = 0; j < iMin; ++j)
       dij[iMin*(iMin-1)/2 + j] = dij[clLast*(clLast-1)/2 + j];
-    for (int j = iMin + 1; j < clLast; ++j)
+    for (int j = iMin + 1; j < clLast; ++j) {
       dij[j*(j-1)/2 + iMin] = dij[clLast*(clLast-1)/2 + j];
+      updateRowMin( j, iMin);
+    }
+    findRowMin( iMin);
   }
 
   // Shrink cluster list by one.
   clusters.pop_back();
+  dRowMin.pop_back();
+  jRowMin.pop_back();
   --clSize;
   --clLast;
 
@@ -1131,28 +1503,58 @@ void SlowJet::list(bool listAll) const {
 
 //--------------------------------------------------------------------------
 
+// Find the nearest neighbour of cluster i, i.e. the smallest of diB[i]
+// and dij[i][j] for j < i. For equal distances the first one is kept,
+// so that the order of clustering is the same as for a full search.
+
+void SlowJet::findRowMin(int i) {
+
+  const double* dRow = dij.data() + i*(i-1)/2;
+  double dNow = diB[i];
+  int    jNow = -1;
+  for (int j = 0; j < i; ++j) if (dRow[j] < dNow) {
+    dNow = dRow[j];
+    jNow = j;
+  }
+  dRowMin[i] = dNow;
+  jRowMin[i] = jNow;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Update the nearest neighbour of cluster i after dij[i][j] has changed.
+// Only if the old nearest neighbour moved further away a new search
+// is needed.
+
+void SlowJet::updateRowMin(int i, int j) {
+
+  double dNow = dij[i*(i-1)/2 + j];
+  if (j == jRowMin[i]) {
+    if (dNow <= dRowMin[i]) dRowMin[i] = dNow;
+    else findRowMin(i);
+  } else if (dNow < dRowMin[i] || (dNow == dRowMin[i] && j < jRowMin[i])) {
+    dRowMin[i] = dNow;
+    jRowMin[i] = j;
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Find next cluster pair to join.
 
 void SlowJet::findNext() {
 
-  // Find smallest of diB, dij.
+  // Find smallest of diB, dij from the nearest neighbour of each cluster.
   if (clSize > 0) {
-    iMin =  0;
-    jMin = -1;
-    dMin = diB[0];
-    for (int i = 1; i < clSize; ++i) {
-      if (diB[i] < dMin) {
-        iMin = i;
-        jMin = -1;
-        dMin = diB[i];
-      }
-      for (int j = 0; j < i; ++j) {
-        if (dij[i*(i-1)/2 + j] < dMin) {
-          iMin = i;
-          jMin = j;
-          dMin = dij[i*(i-1)/2 + j];
-        }
-      }
+    iMin = 0;
+    jMin = jRowMin[0];
+    dMin = dRowMin[0];
+    for (int i = 1; i < clSize; ++i) if (dRowMin[i] < dMin) {
+      iMin = i;
+      jMin = jRowMin[i];
+      dMin = dRowMin[i];
     }
 
   // If no clusters left then instead default values.
@@ -18,7 +18,26 @@ namespace Pythia8 {
 
 // Rndm class.
 // This class handles random number generation according to the
-// Marsaglia-Zaman-Tsang algorithm
+// Marsaglia-Zaman-Tsang algorithm, or optionally the counter-based
+// Philox4x32-10 one.
+
+//--------------------------------------------------------------------------
+
+// Constants: could only be changed for a different algorithm.
+
+// Multipliers and key increments of the Philox4x32 rounds.
+const uint32_t Rndm::PHILOXM0 = 0xD2511F53;
+const uint32_t Rndm::PHILOXM1 = 0xCD9E8D57;
+const uint32_t Rndm::PHILOXW0 = 0x9E3779B9;
+const uint32_t Rndm::PHILOXW1 = 0xBB67AE85;
+
+// Conversion of 52-bit integers to doubles in the range (0, 1).
+const double   Rndm::TWOM52   = 1. / 4503599627370496.;
+
+// Sizes of the buffer and of the Marsaglia-Zaman-Tsang blocks, with the
+// values given in the class, since they also dimension its arrays.
+constexpr int  Rndm::NFLATBUFFER;
+constexpr int  Rndm::NMZBLOCK;
 
 //--------------------------------------------------------------------------
 
@@ -26,8 +45,10 @@ namespace Pythia8 {
 
 bool Rndm::rndmEnginePtr( RndmEnginePtr rndmEngPtrIn) {
 
-  // Save pointer.
+  // Save pointer. Numbers left in the buffer are not used.
   if (rndmEngPtrIn == nullptr) return false;
+  stateSave       = getState();
+  nFlat = iFlat   = 0;
   rndmEngPtr      = rndmEngPtrIn;
   useExternalRndm = true;
 
@@ -85,6 +106,78 @@ void Rndm::init(int seedIn) {
   initRndm = true;
   stateSave.seed = seed;
   stateSave.sequence = 0;
+  stateSave.counterBased = false;
+  nFlat = iFlat = 0;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Initialize the counter-based engine. The random numbers are obtained
+// by encrypting a counter, made of the event number and a block number,
+// with the seed as key. Before the first event a separate sequence,
+// numbered -1, is used, e.g. for the initialization.
+
+void Rndm::initCounter(int seedIn) {
+
+  // Pick seed in the same way as for the default engine.
+  int seed = seedIn;
+  if (seedIn < 0) seed = DEFAULTSEED;
+  else if (seedIn == 0) seed = int(time(0));
+  if (seed < 0) seed = -seed;
+
+  // Start the sequence before the first event.
+  initRndm               = true;
+  stateSave.seed         = seed;
+  stateSave.sequence     = 0;
+  stateSave.counterBased = true;
+  stateSave.event        = -1;
+  stateSave.eventNext    = 0;
+  stateSave.block        = 0;
+  stateSave.iBuffer      = 2;
+  nFlat = iFlat          = 0;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Counter-based engine: start the random sequence of the next event.
+
+void Rndm::nextEvent() {
+
+  if (!stateSave.counterBased) return;
+  stateSave.event   = stateSave.eventNext++;
+  stateSave.block   = 0;
+  stateSave.iBuffer = 2;
+  clearBuffer();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Counter-based engine: generate the two random numbers of a block with
+// the Philox4x32-10 algorithm, see J.K. Salmon et al., Proceedings of
+// SC11 (2011) 16. The 128-bit output gives two numbers with 52 bits.
+
+void Rndm::philox(int seed, long event, long block, double* out) {
+
+  uint32_t ctr[4] = { uint32_t(block), uint32_t(uint64_t(block) >> 32),
+    uint32_t(event), uint32_t(uint64_t(event) >> 32) };
+  uint32_t key[2] = { uint32_t(seed), 0 };
+  for (int iRound = 0; iRound < 10; ++iRound) {
+    uint64_t prod0 = uint64_t(PHILOXM0) * ctr[0];
+    uint64_t prod1 = uint64_t(PHILOXM1) * ctr[2];
+    ctr[0] = uint32_t(prod1 >> 32) ^ ctr[1] ^ key[0];
+    ctr[1] = uint32_t(prod1);
+    ctr[2] = uint32_t(prod0 >> 32) ^ ctr[3] ^ key[1];
+    ctr[3] = uint32_t(prod0);
+    key[0] += PHILOXW0;
+    key[1] += PHILOXW1;
+  }
+  uint64_t bits0 = (uint64_t(ctr[0]) << 32) | ctr[1];
+  uint64_t bits1 = (uint64_t(ctr[2]) << 32) | ctr[3];
+  out[0] = (double(bits0 >> 12) + 0.5) * TWOM52;
+  out[1] = (double(bits1 >> 12) + 0.5) * TWOM52;
 
 }
 
@@ -184,28 +277,133 @@ pair<Vec4, Vec4> Rndm::phaseSpace2Debug(string loc, string file, int line,
 
 //--------------------------------------------------------------------------
 
-// Generate next random number uniformly between 0 and 1.
+// Refill the buffer of random numbers and return the first one.
 
-double Rndm::flat() {
+double Rndm::flatRefill() {
 
-  // Use external random number generator if such has been linked.
-  if (useExternalRndm) return rndmEngPtr->flat();
+  // Use external random number generator if such has been linked,
+  // one number at a time unless buffering has been requested.
+  if (useExternalRndm && !bufferExternalRndm) return rndmEngPtr->flat();
+
+  // Fill the buffer and return its first number.
+  fillBuffer();
+  return flatSave[iFlat++];
+
+}
+
+//--------------------------------------------------------------------------
+
+// Fill the buffer with a block of random numbers. For the internal
+// engines the result is exactly the same sequence as when the numbers
+// are generated one by one.
+
+void Rndm::fillBuffer() {
+
+  // Numbers left in the buffer are not used.
+  clearBuffer();
+
+  // External generator: fill the whole buffer at once.
+  if (useExternalRndm) {
+    rndmEngPtr->flatBlock(flatSave, NFLATBUFFER);
+    nFlat = NFLATBUFFER;
+    return;
+  }
 
-  // Ensure that already initialized.
+  // Ensure that already initialized. Save the state before the buffer,
+  // from which the state at any point within it can be recovered.
   if (!initRndm) init(DEFAULTSEED);
+  stateFlat = stateSave;
+  RndmState& st = stateSave;
+
+  // Counter-based engine: first numbers left over from the last block,
+  // then complete blocks.
+  if (st.counterBased) {
+    while (st.iBuffer < 2) flatSave[nFlat++] = st.buffer[st.iBuffer++];
+    for ( ; nFlat + 2 <= NFLATBUFFER; nFlat += 2)
+      philox(st.seed, st.event, st.block++, flatSave + nFlat);
+    return;
+  }
+
+  // Marsaglia-Zaman-Tsang engine. The carry after k + 1 steps is
+  // c - (k + 1) * cd modulo cm, where all numbers are multiples of 2^-24,
+  // so the offsets can be tabulated without any rounding.
+  if (st.cd != cdCarry || st.cm != cmCarry) {
+    double carry = 0.;
+    for (int k = 0; k < NMZBLOCK; ++k) {
+      carry += st.cd;
+      if (carry >= st.cm) carry -= st.cm;
+      carrySave[k] = carry;
+    }
+    cdCarry = st.cd;
+    cmCarry = st.cm;
+  }
+
+  // The update u[i97] -= u[j97] only depends on the result of an earlier
+  // step after NMZBLOCK steps, so up to that many steps can be taken
+  // together, as long as neither index wraps around. Written without
+  // branches, so that the loop can be vectorized.
+  while (nFlat < NFLATBUFFER) {
+    int nStep = min( min(NMZBLOCK, NFLATBUFFER - nFlat),
+      min(st.i97, st.j97) + 1);
+    double* uI  = st.u + st.i97;
+    double* uJ  = st.u + st.j97;
+    double* out = flatSave + nFlat;
+    bool    rejected = false;
+    for (int k = 0; k < nStep; ++k) {
+      double uni  = uI[-k] - uJ[-k];
+      uni        += (uni < 0.) ? 1. : 0.;
+      uI[-k]      = uni;
+      double cNow = st.c - carrySave[k];
+      cNow       += (cNow < 0.) ? st.cm : 0.;
+      uni        -= cNow;
+      uni        += (uni < 0.) ? 1. : 0.;
+      rejected   |= !(uni > 0. && uni < 1.);
+      out[k]      = uni;
+    }
+
+    // Update indices and carry.
+    st.i97 -= nStep;
+    if (st.i97 < 0) st.i97 = 96;
+    st.j97 -= nStep;
+    if (st.j97 < 0) st.j97 = 96;
+    st.c -= carrySave[nStep - 1];
+    if (st.c < 0.) st.c += st.cm;
+
+    // Zero or one are rejected as before, which very rarely happens.
+    if (!rejected) nFlat += nStep;
+    else for (int k = 0; k < nStep; ++k)
+      if (out[k] > 0. && out[k] < 1.) flatSave[nFlat++] = out[k];
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Generate a single random number uniformly between 0 and 1 from a given
+// state of the internal engines, and update the state.
+
+double Rndm::flatNext(RndmState& state) {
+
+  // Counter-based engine: take the next number of the current block.
+  if (state.counterBased) {
+    if (state.iBuffer == 2) {
+      philox(state.seed, state.event, state.block++, state.buffer);
+      state.iBuffer = 0;
+    }
+    return state.buffer[state.iBuffer++];
+  }
 
   // Find next random number and update saved state.
-  ++stateSave.sequence;
   double uni;
   do {
-    uni = stateSave.u[stateSave.i97] - stateSave.u[stateSave.j97];
+    uni = state.u[state.i97] - state.u[state.j97];
     if (uni < 0.) uni += 1.;
-    stateSave.u[stateSave.i97] = uni;
-    if (--stateSave.i97 < 0) stateSave.i97 = 96;
-    if (--stateSave.j97 < 0) stateSave.j97 = 96;
-    stateSave.c -= stateSave.cd;
-    if (stateSave.c < 0.) stateSave.c += stateSave.cm;
-    uni -= stateSave.c;
+    state.u[state.i97] = uni;
+    if (--state.i97 < 0) state.i97 = 96;
+    if (--state.j97 < 0) state.j97 = 96;
+    state.c -= state.cd;
+    if (state.c < 0.) state.c += state.cm;
+    uni -= state.c;
     if(uni < 0.) uni += 1.;
    } while (uni <= 0. || uni >= 1.);
   return uni;
@@ -214,6 +412,46 @@ double Rndm::flat() {
 
 //--------------------------------------------------------------------------
 
+// Fill a buffer with n random numbers uniformly between 0 and 1, in
+// the same sequence as n calls to flat(), copied from the internal buffer.
+
+void Rndm::flatBlock(double* buffer, int n) {
+
+  // External generator without buffering: pass on the request.
+  if (useExternalRndm && !bufferExternalRndm) {
+    rndmEngPtr->flatBlock(buffer, n);
+    return;
+  }
+
+  // Copy the numbers, refilling the buffer when it has been used up.
+  for (int i = 0; i < n; ) {
+    if (iFlat == nFlat) fillBuffer();
+    int nCopy = min(n - i, nFlat - iFlat);
+    for (int j = 0; j < nCopy; ++j) buffer[i++] = flatSave[iFlat++];
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Get the state of the random number generator. Since numbers are
+// generated ahead, the state is found by stepping forward from the one
+// before the buffer was filled, for the numbers used so far.
+
+RndmState Rndm::getState() const {
+
+  RndmState state = stateSave;
+  if (iFlat < nFlat && !useExternalRndm) {
+    state = stateFlat;
+    for (int i = 0; i < iFlat; ++i) flatNext(state);
+  }
+  state.sequence = stateSave.sequence + iFlat;
+  return state;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Generate a random number according to a Gamma-distribution.
 
 double Rndm::gamma(double k0, double r0) {
@@ -281,18 +519,28 @@ bool Rndm::dumpState(string fileName) {
   }
 
   // Write the state of the generator on the file.
-  ofs.write((char *) &stateSave.seed,     sizeof(int));
-  ofs.write((char *) &stateSave.sequence, sizeof(long));
-  ofs.write((char *) &stateSave.i97,      sizeof(int));
-  ofs.write((char *) &stateSave.j97,      sizeof(int));
-  ofs.write((char *) &stateSave.c,        sizeof(double));
-  ofs.write((char *) &stateSave.cd,       sizeof(double));
-  ofs.write((char *) &stateSave.cm,       sizeof(double));
-  ofs.write((char *) &stateSave.u,        sizeof(double) * 97);
+  RndmState state = getState();
+  ofs.write((char *) &state.seed,     sizeof(int));
+  ofs.write((char *) &state.sequence, sizeof(long));
+  ofs.write((char *) &state.i97,      sizeof(int));
+  ofs.write((char *) &state.j97,      sizeof(int));
+  ofs.write((char *) &state.c,        sizeof(double));
+  ofs.write((char *) &state.cd,       sizeof(double));
+  ofs.write((char *) &state.cm,       sizeof(double));
+  ofs.write((char *) &state.u,        sizeof(double) * 97);
+
+  // The counter-based engine also needs its event and block numbers.
+  if (state.counterBased) {
+    ofs.write((char *) &state.event,     sizeof(long));
+    ofs.write((char *) &state.eventNext, sizeof(long));
+    ofs.write((char *) &state.block,     sizeof(long));
+    ofs.write((char *) &state.iBuffer,   sizeof(int));
+    ofs.write((char *) &state.buffer,    sizeof(double) * 2);
+  }
 
   // Write confirmation on cout.
-  cout << " PYTHIA Rndm::dumpState: seed = " << stateSave.seed
-       << ", sequence no = " << stateSave.sequence << endl;
+  cout << " PYTHIA Rndm::dumpState: seed = " << state.seed
+       << ", sequence no = " << state.sequence << endl;
   return true;
 
 }
@@ -322,6 +570,19 @@ bool Rndm::readState(string fileName) {
   ifs.read((char *) &stateSave.cm,       sizeof(double));
   ifs.read((char *) &stateSave.u,        sizeof(double) *97);
 
+  // Files from the counter-based engine also contain its event and
+  // block numbers.
+  stateSave.counterBased = false;
+  if (ifs.read((char *) &stateSave.event, sizeof(long))) {
+    ifs.read((char *) &stateSave.eventNext, sizeof(long));
+    ifs.read((char *) &stateSave.block,     sizeof(long));
+    ifs.read((char *) &stateSave.iBuffer,   sizeof(int));
+    ifs.read((char *) &stateSave.buffer,    sizeof(double) * 2);
+    stateSave.counterBased = true;
+  }
+  initRndm = true;
+  nFlat = iFlat = 0;
+
   // Write confirmation on cout.
   cout << " PYTHIA Rndm::readState: seed " << stateSave.seed
        << ", sequence no = " << stateSave.sequence << endl;
@@ -338,6 +599,11 @@ bool Rndm::readState(string fileName) {
 
 // Test whether two random states would generate the same random sequence.
 bool RndmState::operator==(const RndmState& other) const {
+  if (counterBased != other.counterBased) return false;
+  if (counterBased)
+    return seed == other.seed && sequence == other.sequence
+      && event == other.event && eventNext == other.eventNext
+      && block == other.block && iBuffer == other.iBuffer;
   if (i97 != other.i97 || j97 != other.j97 || sequence != other.sequence
    || c != other.c || cd != other.cd || cm != other.cm)
     return false;
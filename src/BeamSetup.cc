@@ -30,6 +30,7 @@ bool BeamSetup::setPDFPtr( PDFPtr pdfAPtrIn, PDFPtr pdfBPtrIn,
     = pdfGamAPtr = pdfGamBPtr = pdfHardGamAPtr = pdfHardGamBPtr = pdfUnresAPtr
     = pdfUnresBPtr = pdfUnresGamAPtr = pdfUnresGamBPtr = pdfVMDAPtr
     = pdfVMDBPtr = nullptr;
+  userPDFs = false;
 
   // Switch off external PDF's by zero as input.
   if ( !pdfAPtrIn && !pdfBPtrIn) return true;
@@ -40,6 +41,7 @@ bool BeamSetup::setPDFPtr( PDFPtr pdfAPtrIn, PDFPtr pdfBPtrIn,
   // Save pointers.
   pdfAPtr       = pdfAPtrIn;
   pdfBPtr       = pdfBPtrIn;
+  userPDFs      = true;
 
   // By default same pointers for hard-process PDF's.
   pdfHardAPtr   = pdfAPtrIn;
@@ -109,12 +111,14 @@ bool BeamSetup::setPDFAPtr( PDFPtr pdfAPtrIn ) {
     = pdfGamAPtr = pdfGamBPtr = pdfHardGamAPtr = pdfHardGamBPtr = pdfUnresAPtr
     = pdfUnresBPtr = pdfUnresGamAPtr = pdfUnresGamBPtr = pdfVMDAPtr
     = pdfVMDBPtr = nullptr;
+  userPDFs = false;
 
   // Switch off external PDF's by zero as input.
   if (!pdfAPtrIn) return true;
 
   // Save pointers.
   pdfAPtr       = pdfAPtrIn;
+  userPDFs      = true;
   // By default same pointers for hard-process PDF's.
   pdfHardAPtr   = pdfAPtrIn;
 
@@ -133,12 +137,14 @@ bool BeamSetup::setPDFBPtr( PDFPtr pdfBPtrIn ) {
     = pdfGamAPtr = pdfGamBPtr = pdfHardGamAPtr = pdfHardGamBPtr = pdfUnresAPtr
     = pdfUnresBPtr = pdfUnresGamAPtr = pdfUnresGamBPtr = pdfVMDAPtr
     = pdfVMDBPtr = nullptr;
+  userPDFs = false;
 
   // Switch off external PDF's by zero as input.
   if (!pdfBPtrIn) return true;
 
   // Save pointers.
   pdfBPtr       = pdfBPtrIn;
+  userPDFs      = true;
   // By default same pointers for hard-process PDF's.
   pdfHardBPtr   = pdfBPtrIn;
 
@@ -390,6 +396,11 @@ bool BeamSetup::initFrame() {
       bool useExternal = (lhaUpPtr && !useNewLHA && lhaUpPtr->useExternal());
       if (!useExternal && useNewLHA && skipInit)
         lhaUpPtr->newEventFile(cstring1);
+      else if (!useExternal && lhefDispatcherPtr) {
+        lhaUpPtr = make_shared<LHAupLHEF>(infoPtr, lhefDispatcherPtr,
+          readHeaders, setScales);
+        useNewLHA = true;
+      }
       else if (!useExternal) {
         // Header is optional, so use NULL pointer to indicate no value.
         const char* cstring2 = (lhefHeader == "void")
@@ -1178,7 +1189,7 @@ PDFPtr BeamSetup::getPDFPtr(int idIn, int sequence, string beam,
     if (pSet == 0 && pWord.length() > 9
       && toLower(pWord).substr(0,9) == "lhagrid1:")
       tempPDFPtr = make_shared<LHAGrid1>
-        (idIn, pWord, pdfdataPath, loggerPtr);
+        (idIn, pWord, pdfdataPath, loggerPtr, infoPtr->sharedTablesPtr);
 
     // Use sets from LHAPDF.
     else if (pSet == 0) tempPDFPtr = initLHAPDF(idIn, pWord);
@@ -1194,7 +1205,7 @@ PDFPtr BeamSetup::getPDFPtr(int idIn, int sequence, string beam,
         pdfdataPath, loggerPtr);
     else if (pSet <= 24)
       tempPDFPtr = make_shared<LHAGrid1>
-        (idIn, pWord, pdfdataPath, loggerPtr);
+        (idIn, pWord, pdfdataPath, loggerPtr, infoPtr->sharedTablesPtr);
     else tempPDFPtr = 0;
   }
 
@@ -1282,7 +1293,7 @@ PDFPtr BeamSetup::getPDFPtr(int idIn, int sequence, string beam,
     if (piSet == 0 && piWord.length() > 9
       && toLower(piWord).substr(0,9) == "lhagrid1:")
       tempPDFPtr = make_shared<LHAGrid1>
-        (idIn, piWord, pdfdataPath, loggerPtr);
+        (idIn, piWord, pdfdataPath, loggerPtr, infoPtr->sharedTablesPtr);
 
     // Use sets from LHAPDF.
     else if (piSet == 0) tempPDFPtr = initLHAPDF(idIn, piWord);
@@ -1292,7 +1303,7 @@ PDFPtr BeamSetup::getPDFPtr(int idIn, int sequence, string beam,
     else if (piSet == 2) tempPDFPtr = make_shared<GRSpiL>(idIn, rescale);
     else if (piSet == 3)
       tempPDFPtr = make_shared<LHAGrid1>(idIn, "lhagrid1:SU21piplus.dat",
-        pdfdataPath, loggerPtr);
+        pdfdataPath, loggerPtr, infoPtr->sharedTablesPtr);
     else tempPDFPtr = nullptr;
   }
 
@@ -1308,7 +1319,7 @@ PDFPtr BeamSetup::getPDFPtr(int idIn, int sequence, string beam,
     if (pomSet == 0 && pomWord.length() > 9
       && toLower(pomWord).substr(0,9) == "lhagrid1:")
       tempPDFPtr = make_shared<LHAGrid1>
-        (idIn, pomWord, pdfdataPath, loggerPtr);
+        (idIn, pomWord, pdfdataPath, loggerPtr, infoPtr->sharedTablesPtr);
 
     // Use sets from LHAPDF.
     else if (pomSet == 0) tempPDFPtr = initLHAPDF(idIn, pomWord);
@@ -1346,7 +1357,8 @@ PDFPtr BeamSetup::getPDFPtr(int idIn, int sequence, string beam,
     else if (pomSet == 11 ) tempPDFPtr =
       make_shared<PomHISASD>(990, getPDFPtr(2212), *settingsPtr, loggerPtr);
     else if (pomSet >= 12 && pomSet <= 15) tempPDFPtr =
-      make_shared<LHAGrid1>(idIn, "1" + pomWord, pdfdataPath, loggerPtr);
+      make_shared<LHAGrid1>(idIn, "1" + pomWord, pdfdataPath, loggerPtr,
+        infoPtr->sharedTablesPtr);
     else tempPDFPtr = 0;
   }
 
@@ -1540,7 +1552,8 @@ PDFPtr BeamSetup::getPDFPtr(int idIn, int sequence, string beam,
       case 533: baseParticle = "Omegab"; break;
     }
     tempPDFPtr = make_shared<LHAGrid1>(idIn,
-      "lhagrid1:SU21"+baseParticle+".dat", pdfdataPath, loggerPtr);
+      "lhagrid1:SU21"+baseParticle+".dat", pdfdataPath, loggerPtr,
+      infoPtr->sharedTablesPtr);
   }
 
   // Optionally allow extrapolation beyond x and Q2 limits.
@@ -243,6 +243,7 @@ void DireSpace::init( BeamParticle* beamAPtrIn,
                         : (alphaSorder > 0) ? alphaS.alphaS(pT2min) * 0.5/M_PI
                                             :  0.5 * 0.5/M_PI;
   usePDFmasses       = settingsPtr->flag("ShowerPDF:usePDFmasses");
+  pSetPtr            = settingsPtr->wordPtr("PDF:pSet");
   BeamParticle* bb   = ( particleDataPtr->isHadron(beamAPtr->id())) ? beamAPtr
                      : ( particleDataPtr->isHadron(beamBPtr->id())) ?
     beamBPtr : NULL;
@@ -270,6 +271,7 @@ void DireSpace::init( BeamParticle* beamAPtrIn,
     it != splits.end(); ++it ) overhead.insert(make_pair(it->first,1.));
 
   nFinalMax          = settingsPtr->mode("DireSpace:nFinalMax");
+  nFinalMaxPtr       = settingsPtr->modePtr("DireSpace:nFinalMax");
   useGlobalMapIF     = settingsPtr->flag("DireSpace:useGlobalMapIF");
 
   forceMassiveMap    = settingsPtr->flag("DireSpace:forceMassiveMap");
@@ -1194,10 +1196,11 @@ double DireSpace::pTnext( Event& event, double pTbegAll, double pTendAll,
     double pTbegDip = min( pTbegAll, dipEndNow->pTmax );
 
     // Limit final state multiplicity. For debugging only
-    int nfmax = settingsPtr->mode("DireSpace:nFinalMax");
+    int nfmax = nFinalMaxPtr->valNow;
     int nFinal = 0;
-    for (int i=0; i < event.size(); ++i)
-      if (event[i].isFinal()) nFinal++;
+    if (nfmax > -10)
+      for (int i=0; i < event.size(); ++i)
+        if (event[i].isFinal()) nFinal++;
     if (nfmax > -10 && nFinal > nfmax) continue;
 
     // Check whether dipole end should be allowed to shower.
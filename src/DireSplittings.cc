@@ -25,6 +25,8 @@ void DireSplitting::init() {
     renormMultFac    = settingsPtr->parm("SpaceShower:renormMultFac");
   else
     renormMultFac    = settingsPtr->parm("TimeShower:renormMultFac");
+  pTminFSRPtr        = settingsPtr->parmPtr("TimeShower:pTmin");
+  pTminISRPtr        = settingsPtr->parmPtr("SpaceShower:pTmin");
 
   if ( id.find("_qcd_")      != string::npos) is_qcd  = true;
   if ( id.find("_qed_")      != string::npos) is_qed  = true;
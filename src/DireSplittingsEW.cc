@@ -98,7 +98,7 @@ pair<int,int> Dire_fsr_ew_Q2QZ::radBefCols(
 // Pick z for new splitting.
 double Dire_fsr_ew_Q2QZ::zSplit(double zMinAbs, double, double m2dip) {
   double Rz = rndmPtr->flat();
-  double kappa2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double p = pow( 1. + pow2(1-zMinAbs)/kappa2, Rz );
   double res = 1. - sqrt( p - 1. )*sqrt(kappa2);
   return res;
@@ -110,7 +110,7 @@ double Dire_fsr_ew_Q2QZ::overestimateInt(double zMinAbs, double,
   double wt = 0.;
   double preFac = symmetryFactor() * gaugeFactor();
   // Q -> QG, soft part (currently also used for collinear part).
-  double kappa2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminFSRPtr->valNow)/m2dip;
   wt  = preFac * 2. * 0.5 * log1p(pow2(1.-zMinAbs)/kappa2);
   return wt;
 }
@@ -119,7 +119,7 @@ double Dire_fsr_ew_Q2QZ::overestimateInt(double zMinAbs, double,
 double Dire_fsr_ew_Q2QZ::overestimateDiff(double z, double m2dip, int) {
   double wt = 0.;
   double preFac = symmetryFactor() * gaugeFactor();
-  double kappaOld2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaOld2 = pow2(pTminFSRPtr->valNow)/m2dip;
   wt  = preFac * 2.* (1.-z) / ( pow2(1.-z) + kappaOld2);
   return wt;
 }
@@ -294,7 +294,7 @@ pair<int,int> Dire_fsr_ew_Q2ZQ::radBefCols( int colRadAfter, int acolRadAfter,
 // Pick z for new splitting.
 double Dire_fsr_ew_Q2ZQ::zSplit(double zMinAbs, double, double m2dip) {
   double Rz = rndmPtr->flat();
-  double kappa2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double p = pow( 1. + pow2(1-zMinAbs)/kappa2, Rz );
   double res = 1. - sqrt( p - 1. )*sqrt(kappa2);
   return res;
@@ -306,7 +306,7 @@ double Dire_fsr_ew_Q2ZQ::overestimateInt(double zMinAbs, double,
   double wt = 0.;
   double preFac = symmetryFactor() * gaugeFactor();
   // Q -> QG, soft part (currently also used for collinear part).
-  double kappa2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminFSRPtr->valNow)/m2dip;
   wt  = preFac * 2. * 0.5 * log1p(pow2(1.-zMinAbs)/kappa2);
   return wt;
 }
@@ -315,7 +315,7 @@ double Dire_fsr_ew_Q2ZQ::overestimateInt(double zMinAbs, double,
 double Dire_fsr_ew_Q2ZQ::overestimateDiff(double z, double m2dip, int) {
   double wt = 0.;
   double preFac = symmetryFactor() * gaugeFactor();
-  double kappaOld2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaOld2 = pow2(pTminFSRPtr->valNow)/m2dip;
   wt  = preFac * 2.* (1.-z) / ( pow2(1.-z) + kappaOld2);
   return wt;
 }
@@ -1457,7 +1457,7 @@ pair<int,int> Dire_isr_ew_Q2QZ::radBefCols(
 // Pick z for new splitting.
 double Dire_isr_ew_Q2QZ::zSplit(double zMinAbs, double, double m2dip) {
   double Rz = rndmPtr->flat();
-  double kappa2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminISRPtr->valNow)/m2dip;
   double p = pow( 1. + pow2(1-zMinAbs)/kappa2, Rz );
   double res = 1. - sqrt( p - 1. )*sqrt(kappa2);
   return res;
@@ -1468,7 +1468,7 @@ double Dire_isr_ew_Q2QZ::overestimateInt(double zMinAbs, double,
   double, double m2dip, int ) {
   double wt     = 0.;
   double preFac = symmetryFactor() * gaugeFactor();
-  double kappa2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminISRPtr->valNow)/m2dip;
   wt  = preFac * 2. * 0.5 * log1p(pow2(1.-zMinAbs)/kappa2);
   return wt;
 }
@@ -1477,7 +1477,7 @@ double Dire_isr_ew_Q2QZ::overestimateInt(double zMinAbs, double,
 double Dire_isr_ew_Q2QZ::overestimateDiff(double z, double m2dip, int ) {
   double wt        = 0.;
   double preFac    = symmetryFactor() * gaugeFactor();
-  double kappaOld2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappaOld2 = pow2(pTminISRPtr->valNow)/m2dip;
   wt  = preFac * 2.* (1.-z) / ( pow2(1.-z) + kappaOld2);
   return wt;
 }
@@ -936,7 +936,7 @@ pair<int,int> Dire_fsr_qcd_Q2QGG::radBefCols(
 double Dire_fsr_qcd_Q2QGG::zSplit(double, double, double m2dip) {
   double R = rndmPtr->flat();
   // Pick according to soft + 1/(z+kappa2)
-  double a = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double a = pow2(pTminFSRPtr->valNow)/m2dip;
   double z1 = pow((1+a)/a,-R)*(1+a) - a;
   return z1;
 
@@ -946,7 +946,7 @@ double Dire_fsr_qcd_Q2QGG::zSplit(double, double, double m2dip) {
 double Dire_fsr_qcd_Q2QGG::overestimateInt(double, double,
   double, double m2dip, int) {
   double wt     = 0.;
-  double kappa2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminFSRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/(z+kappa2)
   wt = 16*CF*log( (kappa2 + 1)/kappa2);
   return wt;
@@ -955,7 +955,7 @@ double Dire_fsr_qcd_Q2QGG::overestimateInt(double, double,
 // Return overestimate for new splitting.
 double Dire_fsr_qcd_Q2QGG::overestimateDiff(double z, double m2dip, int) {
   double wt        = 0.;
-  double kappaOld2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaOld2 = pow2(pTminFSRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/(z+kappa2)
   wt  = 16*CF / (z + kappaOld2);
   return wt;
@@ -970,7 +970,7 @@ double Dire_fsr_qcd_Q2QGG::counterTerm(double si1, double si2, double sj1,
   double kTi12 = (si1*s12)/(si1+si2+s12);
   double kTi1j = (si1*sj1)/(si1+sj1+sij);
   if ( kTi12 > kT12
-    && kTi1j > pow2(settingsPtr->parm("TimeShower:pTmin"))) return 0.;
+    && kTi1j > pow2(pTminFSRPtr->valNow)) return 0.;
 
   // Multiplicative weight factor to force first eikonal to current
   // outgoing momenta.
@@ -1113,7 +1113,7 @@ bool Dire_fsr_qcd_Q2QGG::calc(const Event& state, int orderNow) {
     double kT12 = ((si1+si2)*(sj1+sj2)-sij*s12)/(si1+si2+sj1+sj2+sij+s12);
 
     if ( abs(sai) < 1e-10 || splitInfo.terminateEvolution == true
-      || kT12 < pow2(settingsPtr->parm("TimeShower:pTmin"))) {
+      || kT12 < pow2(pTminFSRPtr->valNow)) {
       wts.insert( make_pair("base", 0.) );
       if (doVariations && settingsPtr->parm("Variations:muRfsrDown") != 1.)
         wts.insert( make_pair("Variations:muRfsrDown", 0.));
@@ -1294,7 +1294,7 @@ pair<int,int> Dire_fsr_qcd_G2GGG::radBefCols(
 double Dire_fsr_qcd_G2GGG::zSplit(double zMinAbs, double, double m2dip) {
   double R = rndmPtr->flat();
   // Pick according to soft + 1/(z+kappa2)
-  double a = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double a = pow2(pTminFSRPtr->valNow)/m2dip;
 
 double zmin = zMinAbs;
 
@@ -1323,7 +1323,7 @@ double Dire_fsr_qcd_G2GGG::overestimateInt(double zMinAbs, double zMaxAbs,
   double, double m2dip, int orderNow) {
   double wt     = 0.;
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminFSRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/(z+kappa2)
   wt = CA/2.*CA * softRescaleInt(order) * 2.
      * 0.5 * ( log( (kappa2 + pow2(1-zMinAbs)) / (kappa2 + pow2(1-zMaxAbs)))
@@ -1337,7 +1337,7 @@ double Dire_fsr_qcd_G2GGG::overestimateDiff(double z, double m2dip,
   int orderNow) {
   double wt        = 0.;
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaOld2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaOld2 = pow2(pTminFSRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/(z+kappa2)
   wt  = CA/2.*CA * softRescaleInt(order)
       * 2.* ((1.-z) / ( pow2(1.-z) + kappaOld2) + 1./(z+kappaOld2));
@@ -1486,7 +1486,7 @@ bool Dire_fsr_qcd_G2GGG::calc(const Event& state, int orderNow) {
     // never produced by PS, hence no underlying Born to correct.
     double kT12 = ((si1+si2)*(sj1+sj2)-sij*s12)/(si1+si2+sj1+sj2+sij+s12);
     if ( abs(sai) < 1e-10 || splitInfo.terminateEvolution == true
-      || kT12 < pow2(settingsPtr->parm("TimeShower:pTmin"))) {
+      || kT12 < pow2(pTminFSRPtr->valNow)) {
       wts.insert( make_pair("base", 0.) );
       if (doVariations && settingsPtr->parm("Variations:muRfsrDown") != 1.)
         wts.insert( make_pair("Variations:muRfsrDown", 0.));
@@ -1668,7 +1668,7 @@ pair<int,int> Dire_fsr_qcd_Q2Qqqbar::radBefCols(
 double Dire_fsr_qcd_Q2Qqqbar::zSplit(double zMinAbs, double, double m2dip) {
   double R = rndmPtr->flat();
   // Pick according to soft + 1/(z+kappa2)
-  double a = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double a = pow2(pTminFSRPtr->valNow)/m2dip;
 
 double zmin = zMinAbs;
 
@@ -1697,7 +1697,7 @@ double Dire_fsr_qcd_Q2Qqqbar::overestimateInt(double zMinAbs, double zMaxAbs,
   double, double m2dip, int orderNow) {
   double wt     = 0.;
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminFSRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/(z+kappa2)
   wt = CF*TR * softRescaleInt(order) * 2.
      * 0.5 * ( log( (kappa2 + pow2(1-zMinAbs)) / (kappa2 + pow2(1-zMaxAbs)))
@@ -1711,7 +1711,7 @@ double Dire_fsr_qcd_Q2Qqqbar::overestimateDiff(double z, double m2dip,
   int orderNow) {
   double wt        = 0.;
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2    = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2    = pow2(pTminFSRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/(z+kappa2)
   wt  = CF*TR * softRescaleInt(order)
       * 2.* ((1.-z) / ( pow2(1.-z) + kappa2) + 1./(z+kappa2));
@@ -1850,7 +1850,7 @@ bool Dire_fsr_qcd_Q2Qqqbar::calc(const Event& state, int orderNow) {
     // never produced by PS, hence no underlying Born to correct.
     double kT12 = ((si1+si2)*(sj1+sj2)-sij*s12)/(si1+si2+sj1+sj2+sij+s12);
     if ( abs(sai) < 1e-10
-      || kT12 < pow2(settingsPtr->parm("TimeShower:pTmin")) ) {
+      || kT12 < pow2(pTminFSRPtr->valNow) ) {
       wts.insert( make_pair("base", 0.) );
       if (doVariations && settingsPtr->parm("Variations:muRfsrDown") != 1.)
         wts.insert( make_pair("Variations:muRfsrDown", 0.));
@@ -2008,7 +2008,7 @@ pair<int,int> Dire_fsr_qcd_G2Gqqbar::radBefCols(
 double Dire_fsr_qcd_G2Gqqbar::zSplit(double zMinAbs, double, double m2dip) {
   double R = rndmPtr->flat();
   // Pick according to soft + 1/(z+kappa2)
-  double a = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double a = pow2(pTminFSRPtr->valNow)/m2dip;
 double zmin = zMinAbs;
 double z1 = (2*pow(a,R) + 4*pow(a,1 + R) + 2*pow(a,2 + R) +
         2*pow(a,2)*pow(1 + a - 2*zmin + pow(zmin,2),R)
@@ -2034,7 +2034,7 @@ double Dire_fsr_qcd_G2Gqqbar::overestimateInt(double zMinAbs, double zMaxAbs,
   double, double m2dip, int orderNow) {
   double wt     = 0.;
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminFSRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/(z+kappa2)
   wt = CA/2.*TR * softRescaleInt(order) * 2.
      * 0.5 * ( log( (kappa2 + pow2(1-zMinAbs)) / (kappa2 + pow2(1-zMaxAbs)))
@@ -2049,7 +2049,7 @@ double Dire_fsr_qcd_G2Gqqbar::overestimateDiff(double z, double m2dip,
   int orderNow) {
   double wt        = 0.;
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2    = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappa2    = pow2(pTminFSRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/(z+kappa2)
   wt  = CA/2.*TR * softRescaleInt(order)
       * 2.* ((1.-z) / ( pow2(1.-z) + kappa2) + 1./(z+kappa2));
@@ -2188,7 +2188,7 @@ bool Dire_fsr_qcd_G2Gqqbar::calc(const Event& state, int orderNow) {
     // never produced by PS, hence no underlying Born to correct.
     double kT12 = ((si1+si2)*(sj1+sj2)-sij*s12)/(si1+si2+sj1+sj2+sij+s12);
     if ( abs(sai) < 1e-10
-      || kT12 < pow2(settingsPtr->parm("TimeShower:pTmin")) ) {
+      || kT12 < pow2(pTminFSRPtr->valNow) ) {
       wts.insert( make_pair("base", 0.) );
       if (doVariations && settingsPtr->parm("Variations:muRfsrDown") != 1.)
         wts.insert( make_pair("Variations:muRfsrDown", 0.));
@@ -2340,7 +2340,7 @@ vector <int> Dire_fsr_qcd_Q2QG::recPositions( const Event& state, int iRad,
 // Pick z for new splitting.
 double Dire_fsr_qcd_Q2QG::zSplit(double zMinAbs, double, double m2dip) {
   double Rz        = rndmPtr->flat();
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double p         = pow( 1. + pow2(1-zMinAbs)/kappaMin2, Rz );
   double res       = 1. - sqrt( p - 1. )*sqrt(kappaMin2);
   return res;
@@ -2352,7 +2352,7 @@ double Dire_fsr_qcd_Q2QG::overestimateInt(double zMinAbs, double,
   // Q -> QG, soft part (currently also used for collinear part).
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double wt        = preFac * softRescaleInt(order)
                      *2. * 0.5 * log( 1. + pow2(1.-zMinAbs)/kappaMin2);
   return wt;
@@ -2363,7 +2363,7 @@ double Dire_fsr_qcd_Q2QG::overestimateDiff(double z, double m2dip,
   int orderNow) {
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double wt        = preFac * softRescaleInt(order)
                      *2. * (1.-z) / ( pow2(1.-z) + kappaMin2);
   return wt;
@@ -2398,7 +2398,7 @@ bool Dire_fsr_qcd_Q2QG::calc(const Event& state, int orderNow) {
   // i.e. the gluon is soft and the quark is identified.
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   // Calculate argument of alphaS.
@@ -2742,7 +2742,7 @@ vector <int> Dire_fsr_qcd_Q2GQ::recPositions( const Event& state, int iRad,
 // Pick z for new splitting.
 double Dire_fsr_qcd_Q2GQ::zSplit(double zMinAbs, double, double m2dip) {
   double Rz        = rndmPtr->flat();
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double p         = pow( 1. + pow2(1-zMinAbs)/kappaMin2, Rz );
   double res       = 1. - sqrt( p - 1. )*sqrt(kappaMin2);
   return res;
@@ -2754,7 +2754,7 @@ double Dire_fsr_qcd_Q2GQ::overestimateInt(double zMinAbs, double,
   // Q -> QG, soft part (currently also used for collinear part).
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double wt        = preFac * 2. * 0.5 * log( 1. + pow2(1.-zMinAbs)/kappaMin2);
 
   // Rescale with soft cusp term only if NLO corrections are absent.
@@ -2771,7 +2771,7 @@ double Dire_fsr_qcd_Q2GQ::overestimateDiff(double z, double m2dip,
   int orderNow) {
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double wt        = preFac * 2.* (1.-z) / ( pow2(1.-z) + kappaMin2);
   // Rescale with soft cusp term only if NLO corrections are absent.
   // This choice is purely heuristical to improve LEP description.
@@ -2802,7 +2802,7 @@ bool Dire_fsr_qcd_Q2GQ::calc(const Event& state, int orderNow) {
   // i.e. the quark is soft and the gluon is identified.
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   unordered_map<string,double> wts;
@@ -3061,7 +3061,7 @@ vector <int> Dire_fsr_qcd_G2GG1::recPositions( const Event& state, int iRad,
 double Dire_fsr_qcd_G2GG1::zSplit(double zMinAbs, double, double m2dip) {
   // Just pick according to soft.
   double R         = rndmPtr->flat();
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double p         = pow( 1. + pow2(1-zMinAbs)/kappaMin2, R );
   double res       = 1. - sqrt( p - 1. )*sqrt(kappaMin2);
   return res;
@@ -3074,7 +3074,7 @@ double Dire_fsr_qcd_G2GG1::overestimateInt(double zMinAbs, double,
   // Overestimate by soft
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double wt        = preFac * softRescaleInt(order)
                      *0.5 * log( 1. + pow2(1.-zMinAbs)/kappaMin2);
   if (useBackboneGluons) wt *= 2.;
@@ -3087,7 +3087,7 @@ double Dire_fsr_qcd_G2GG1::overestimateDiff(double z, double m2dip,
   // Overestimate by soft
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double wt        = preFac * softRescaleInt(order)
                      *(1.-z) / ( pow2(1.-z) + kappaMin2);
   if (useBackboneGluons) wt *= 2.;
@@ -3139,7 +3139,7 @@ bool Dire_fsr_qcd_G2GG1::calc(const Event& state, int orderNow) {
   }
 
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   // Calculate kernel.
@@ -3481,7 +3481,7 @@ vector <int> Dire_fsr_qcd_G2GG2::recPositions( const Event& state, int iRad,
 double Dire_fsr_qcd_G2GG2::zSplit(double zMinAbs, double, double m2dip) {
   // Just pick according to soft.
   double R         = rndmPtr->flat();
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double p         = pow( 1. + pow2(1-zMinAbs)/kappaMin2, R );
   double res       = 1. - sqrt( p - 1. )*sqrt(kappaMin2);
   return res;
@@ -3494,7 +3494,7 @@ double Dire_fsr_qcd_G2GG2::overestimateInt(double zMinAbs, double,
   double preFac    = symmetryFactor() * gaugeFactor();
   //int order        = (orderNow > 0) ? orderNow : correctionOrder;
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double wt        = preFac * softRescaleInt(order)
                      *0.5 * log( 1. + pow2(1.-zMinAbs)/kappaMin2);
   if (useBackboneGluons) wt *= 2.;
@@ -3507,7 +3507,7 @@ double Dire_fsr_qcd_G2GG2::overestimateDiff(double z, double m2dip,
   // Overestimate by soft
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaMin2 = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2 = pow2(pTminFSRPtr->valNow)/m2dip;
   double wt        = preFac * softRescaleInt(order)
                      *(1.-z) / ( pow2(1.-z) + kappaMin2);
   if (useBackboneGluons) wt *= 2.;
@@ -3559,7 +3559,7 @@ bool Dire_fsr_qcd_G2GG2::calc(const Event& state, int orderNow) {
   }
 
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   // Calculate kernel.
@@ -3929,7 +3929,7 @@ bool Dire_fsr_qcd_G2QQ1::calc(const Event& state, int orderNow) {
 
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   unordered_map<string,double> wts;
@@ -4228,7 +4228,7 @@ bool Dire_fsr_qcd_G2QQ2::calc(const Event& state, int orderNow) {
 
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   unordered_map<string,double> wts;
@@ -4465,7 +4465,7 @@ double Dire_fsr_qcd_Q2qQqbarDist::zSplit(double zMinAbs, double zMaxAbs,
   double m2dip) {
 
   double Rz         = rndmPtr->flat();
-  double kappa4  = pow(settingsPtr->parm("TimeShower:pTmin"), 4) / pow2(m2dip);
+  double kappa4  = pow(pTminFSRPtr->valNow, 4) / pow2(m2dip);
   double res     = 1.;
   // z est from 1/(z + kappa^4)
   res = pow( (kappa4 + zMaxAbs)/(kappa4 + zMinAbs), -Rz )
@@ -4485,7 +4485,7 @@ double Dire_fsr_qcd_Q2qQqbarDist::overestimateInt(double zMinAbs,
   if (order != 3) return 0.0;
 
   double preFac  = symmetryFactor() * gaugeFactor();
-  double pT2min  = pow2(settingsPtr->parm("TimeShower:pTmin"));
+  double pT2min  = pow2(pTminFSRPtr->valNow);
   double kappa4  = pow2(pT2min/m2dip);
   // Overestimate chosen to have accept weights below one for kappa~0.1
   // z est from 1/(z + kappa^4)
@@ -4508,7 +4508,7 @@ double Dire_fsr_qcd_Q2qQqbarDist::overestimateDiff(double z, double m2dip,
   if (order < 3) return 0.0;
 
   double preFac    = symmetryFactor() * gaugeFactor();
-  double pT2min    = pow2(settingsPtr->parm("TimeShower:pTmin"));
+  double pT2min    = pow2(pTminFSRPtr->valNow);
   double kappa4    = pow2(pT2min/m2dip);
   // Overestimate chosen to have accept weights below one for kappa~0.1
   double wt = preFac * TR * 2. * ( NF_qcd_fsr - 1. ) * 20./ 9. * 1
@@ -4740,7 +4740,7 @@ double Dire_fsr_qcd_Q2QbarQQId::zSplit(double zMinAbs, double zMaxAbs,
 
   // z est from 1/4 z/(z^2 + kappa^2)
   double Rz         = rndmPtr->flat();
-  double kappaMin2  = pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip;
+  double kappaMin2  = pow2(pTminFSRPtr->valNow)/m2dip;
   double p          = (kappaMin2 + zMaxAbs*zMaxAbs)
                     / (kappaMin2 + zMinAbs*zMinAbs);
   double res        = sqrt( (kappaMin2 + zMaxAbs*zMaxAbs - kappaMin2*pow(p,Rz))
@@ -4759,7 +4759,7 @@ double Dire_fsr_qcd_Q2QbarQQId::overestimateInt(double zMinAbs, double zMaxAbs,
 
   // z est from 1/4 z/(z^2 + kappa^2)
   double preFac     = symmetryFactor() * gaugeFactor();
-  double pT2min     = pow2(settingsPtr->parm("TimeShower:pTmin"));
+  double pT2min     = pow2(pTminFSRPtr->valNow);
   double kappaMin2  = pT2min/m2dip;
   double wt         = preFac * TR * 20./9.
                       * 0.5 * log( ( kappaMin2 + zMaxAbs*zMaxAbs)
@@ -4779,7 +4779,7 @@ double Dire_fsr_qcd_Q2QbarQQId::overestimateDiff(double z, double m2dip,
   if (order < 3) return 0.0;
 
   double preFac     = symmetryFactor() * gaugeFactor();
-  double pT2min     = pow2(settingsPtr->parm("TimeShower:pTmin"));
+  double pT2min     = pow2(pTminFSRPtr->valNow);
   double kappaMin2  = pT2min/m2dip;
   double wt         = preFac * TR * 20./ 9. * z / (z*z + kappaMin2);
   // This splitting is down by one power of alphaS !
@@ -5071,7 +5071,7 @@ vector <int> Dire_isr_qcd_Q2QG::recPositions( const Event& state, int iRad,
 // Pick z for new splitting.
 double Dire_isr_qcd_Q2QG::zSplit(double zMinAbs, double, double m2dip) {
   double Rz = rndmPtr->flat();
-  double kappa2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminISRPtr->valNow)/m2dip;
   double p = pow( 1. + pow2(1-zMinAbs)/kappa2, Rz );
   double res = 1. - sqrt( p - 1. )*sqrt(kappa2);
   return res;
@@ -5083,7 +5083,7 @@ double Dire_isr_qcd_Q2QG::overestimateInt(double zMinAbs, double,
   double wt     = 0.;
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminISRPtr->valNow)/m2dip;
   wt  = preFac * softRescaleInt(order)
       * 2. * 0.5 * log( 1. + pow2(1.-zMinAbs)/kappa2);
   return wt;
@@ -5095,7 +5095,7 @@ double Dire_isr_qcd_Q2QG::overestimateDiff(double z, double m2dip,
   double wt        = 0.;
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaOld2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappaOld2 = pow2(pTminISRPtr->valNow)/m2dip;
   wt  = preFac * softRescaleInt(order)
       * 2.* (1.-z) / ( pow2(1.-z) + kappaOld2);
   return wt;
@@ -5113,7 +5113,7 @@ bool Dire_isr_qcd_Q2QG::calc(const Event& state, int orderNow) {
 
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("SpaceShower:pTmin"))
+  double kappa2 = max(pow2(pTminISRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   unordered_map<string,double> wts;
@@ -5270,7 +5270,7 @@ vector <int> Dire_isr_qcd_G2GG1::recPositions( const Event& state, int iRad,
 // Pick z for new splitting.
 double Dire_isr_qcd_G2GG1::zSplit(double zMinAbs, double, double m2dip) {
   double R = rndmPtr->flat();
-  double kappa2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminISRPtr->valNow)/m2dip;
   // Pick according to soft + 1/z
   double res = (-2.*pow(kappa2,R)*pow(zMinAbs,2.*R) +
              sqrt(4.*pow(kappa2,2.*R)
@@ -5292,7 +5292,7 @@ double Dire_isr_qcd_G2GG1::overestimateInt(double zMinAbs, double,
   double wt     = 0.;
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminISRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/z
   wt   = preFac * softRescaleInt(order)
        *0.5*( log(1./pow2(zMinAbs) + pow2(1.-zMinAbs)/(kappa2*pow2(zMinAbs))));
@@ -5306,7 +5306,7 @@ double Dire_isr_qcd_G2GG1::overestimateDiff(double z, double m2dip,
   double wt        = 0.;
   double preFac    = symmetryFactor() * gaugeFactor();
   int order        = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappaOld2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappaOld2 = pow2(pTminISRPtr->valNow)/m2dip;
   // Overestimate by soft + 1/z
   wt  = preFac * softRescaleInt(order)
       * ((1.-z) / ( pow2(1.-z) + kappaOld2) + 1./z);
@@ -5327,7 +5327,7 @@ bool Dire_isr_qcd_G2GG1::calc(const Event& state, int orderNow) {
 
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("SpaceShower:pTmin"))
+  double kappa2 = max(pow2(pTminISRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   unordered_map<string,double> wts;
@@ -5527,7 +5527,7 @@ vector <int> Dire_isr_qcd_G2GG2::recPositions( const Event& state, int iRad,
 // Pick z for new splitting.
 double Dire_isr_qcd_G2GG2::zSplit(double zMinAbs, double, double m2dip) {
   double R      = rndmPtr->flat();
-  double kappa2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminISRPtr->valNow)/m2dip;
 
   // Pick according to soft + 1/z
   double res = (-2.*pow(kappa2,R)*pow(zMinAbs,2.*R) +
@@ -5549,7 +5549,7 @@ double Dire_isr_qcd_G2GG2::overestimateInt(double zMinAbs, double,
   double, double m2dip, int) {
   double wt     = 0.;
   double preFac = symmetryFactor() * gaugeFactor();
-  double kappa2 = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2 = pow2(pTminISRPtr->valNow)/m2dip;
 
   // Overestimate by soft + 1/z
   wt   = preFac
@@ -5562,7 +5562,7 @@ double Dire_isr_qcd_G2GG2::overestimateInt(double zMinAbs, double,
 double Dire_isr_qcd_G2GG2::overestimateDiff(double z, double m2dip, int) {
   double wt        = 0.;
   double preFac    = symmetryFactor() * gaugeFactor();
-  double kappa2    = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2    = pow2(pTminISRPtr->valNow)/m2dip;
 
   // Overestimate by soft + 1/z
   wt  = preFac
@@ -5584,7 +5584,7 @@ bool Dire_isr_qcd_G2GG2::calc(const Event& state, int orderNow) {
 
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip,
+  double kappa2 = max(pow2(pTminISRPtr->valNow)/m2dip,
                       pT2/m2dip);
 
   unordered_map<string,double> wts;
@@ -5813,7 +5813,7 @@ bool Dire_isr_qcd_G2QQ::calc(const Event& state, int orderNow) {
 
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("SpaceShower:pTmin"))
+  double kappa2 = max(pow2(pTminISRPtr->valNow)
                       /m2dip, pT2/m2dip);;
 
   unordered_map<string,double> wts;
@@ -6020,7 +6020,7 @@ bool Dire_isr_qcd_Q2GQ::calc(const Event& state, int orderNow) {
 
   double preFac = symmetryFactor() * gaugeFactor();
   int order     = (orderNow > -1) ? orderNow : correctionOrder;
-  double kappa2 = max(pow2(settingsPtr->parm("SpaceShower:pTmin"))
+  double kappa2 = max(pow2(pTminISRPtr->valNow)
                       /m2dip, pT2/m2dip);;
 
   unordered_map<string,double> wts;
@@ -6169,7 +6169,7 @@ double Dire_isr_qcd_Q2qQqbarDist::zSplit(double zMinAbs, double zMaxAbs,
   double Rz      = rndmPtr->flat();
   double res     = 1.;
   // z est from 1/(z + kappa^2)
-  double kappa2  = pow(settingsPtr->parm("SpaceShower:pTmin"), 2) / m2dip;
+  double kappa2  = pow(pTminISRPtr->valNow, 2) / m2dip;
 
   res = pow( (pow(kappa2,1) + zMaxAbs)/(pow(kappa2,1) + zMinAbs), -Rz )
       * (pow(kappa2,1) + zMaxAbs - pow(kappa2,1)
@@ -6199,7 +6199,7 @@ double Dire_isr_qcd_Q2qQqbarDist::overestimateInt(double zMinAbs,
   if (order < 3) return 0.0;
 
   double preFac  = symmetryFactor() * gaugeFactor();
-  double pT2min  = pow2(settingsPtr->parm("SpaceShower:pTmin"));
+  double pT2min  = pow2(pTminISRPtr->valNow);
   // Overestimate chosen to have accept weights below one for kappa~0.1
   // z est from 1/(z + kappa^2)
   double kappa2  = pT2min/m2dip;
@@ -6232,7 +6232,7 @@ double Dire_isr_qcd_Q2qQqbarDist::overestimateDiff(double z, double m2dip,
   if (order < 3) return 0.0;
 
   double preFac    = symmetryFactor() * gaugeFactor();
-  double pT2min    = pow2(settingsPtr->parm("SpaceShower:pTmin"));
+  double pT2min    = pow2(pTminISRPtr->valNow);
   // Overestimate chosen to have accept weights below one for kappa~0.1
   double kappa2    = pT2min/m2dip;
 
@@ -6312,7 +6312,7 @@ bool Dire_isr_qcd_Q2qQqbarDist::calc(const Event& state, int orderNow) {
   double z1(-sign*pa*pk/(-sign*pk*(pa-pi-pj))),
          z2(sign*pi*pk/(-sign*pk*(pa-pi-pj))),
          z3(1-z1-z2);
-  double pT2min = pow2(settingsPtr->parm("SpaceShower:pTmin"));
+  double pT2min = pow2(pTminISRPtr->valNow);
   if ( z1< 1. || z2 > 0. || z3 > 0.)
     physical = false;
   if ( splitInfo.recBef()->isFinal && -(q2+pT2/xa-p2ai) < pT2min)
@@ -6469,7 +6469,7 @@ pair<int,int> Dire_isr_qcd_Q2QbarQQId::radBefCols(
 double Dire_isr_qcd_Q2QbarQQId::zSplit(double zMinAbs, double zMaxAbs,
   double m2dip) {
   double Rz = rndmPtr->flat();
-  double kappa2  = pow2(settingsPtr->parm("SpaceShower:pTmin"))/m2dip;
+  double kappa2  = pow2(pTminISRPtr->valNow)/m2dip;
 
   double res = pow( (pow(kappa2,1) + zMaxAbs)/(pow(kappa2,1) + zMinAbs), -Rz )
                   * (pow(kappa2,1) + zMaxAbs - pow(kappa2,1)
@@ -6497,7 +6497,7 @@ double Dire_isr_qcd_Q2QbarQQId::overestimateInt(double zMinAbs, double zMaxAbs,
   if (order < 3) return 0.0;
 
   double preFac = symmetryFactor() * gaugeFactor();
-  double pT2min = pow2(settingsPtr->parm("SpaceShower:pTmin"));
+  double pT2min = pow2(pTminISRPtr->valNow);
   double kappa2 = pT2min/m2dip;
 
   double wt = preFac * TR * 20./9.
@@ -6530,7 +6530,7 @@ double Dire_isr_qcd_Q2QbarQQId::overestimateDiff(double z, double m2dip,
 
   double wt      = 0.;
   double preFac  = symmetryFactor() * gaugeFactor();
-  double pT2min  = pow2(settingsPtr->parm("SpaceShower:pTmin"));
+  double pT2min  = pow2(pTminISRPtr->valNow);
   double kappa2  = pT2min/m2dip;
 
   wt  = preFac * TR * 20./9. * 1. / ( z + kappa2);
@@ -6610,7 +6610,7 @@ bool Dire_isr_qcd_Q2QbarQQId::calc(const Event& state, int orderNow) {
   double z1(-sign*pa*pk/(-sign*pk*(pa-pi-pj))),
          z2(sign*pi*pk/(-sign*pk*(pa-pi-pj))),
          z3(1-z1-z2);
-  double pT2min = pow2(settingsPtr->parm("SpaceShower:pTmin"));
+  double pT2min = pow2(pTminISRPtr->valNow);
   if ( z1< 1. || z2 > 0. || z3 > 0.)
     physical = false;
   if ( splitInfo.recBef()->isFinal && -(q2+pT2/xa-p2ai) < pT2min)
@@ -6820,7 +6820,7 @@ double Dire_fsr_qcd_Q2QG_notPartial::zSplit(double zMinAbs, double,
   double m2dip) {
   double Rz        = rndmPtr->flat();
 
-  double kappaMin4 = pow4(settingsPtr->parm("TimeShower:pTmin"))/pow2(m2dip);
+  double kappaMin4 = pow4(pTminFSRPtr->valNow)/pow2(m2dip);
   double p         = pow( 1. + pow2(1-zMinAbs)/kappaMin4, Rz );
   double res       = 1. - sqrt( p - 1. )*sqrt(kappaMin4);
   return res;
@@ -6832,7 +6832,7 @@ double Dire_fsr_qcd_Q2QG_notPartial::overestimateInt(double zMinAbs, double,
 
   // Q -> QG, soft part (currently also used for collinear part).
   double preFac    = symmetryFactor() * gaugeFactor();
-  double kappaMin4 = pow4(settingsPtr->parm("TimeShower:pTmin"))/pow2(m2dip);
+  double kappaMin4 = pow4(pTminFSRPtr->valNow)/pow2(m2dip);
   double wt        = preFac
                      *2. * 0.5 * log( 1. + pow2(1.-zMinAbs)/kappaMin4);
   return wt;
@@ -6843,7 +6843,7 @@ double Dire_fsr_qcd_Q2QG_notPartial::overestimateDiff(double z, double m2dip,
   int) {
 
   double preFac    = symmetryFactor() * gaugeFactor();
-  double kappaMin4 = pow4(settingsPtr->parm("TimeShower:pTmin"))/pow2(m2dip);
+  double kappaMin4 = pow4(pTminFSRPtr->valNow)/pow2(m2dip);
   double wt        = preFac
                      *2. * (1.-z) / ( pow2(1.-z) + kappaMin4);
   return wt;
@@ -6867,7 +6867,7 @@ bool Dire_fsr_qcd_Q2QG_notPartial::calc(const Event& state, int) {
   // Calculate kernel.
   // Note: We are calculating the z <--> 1-z symmetrised kernel here.
   double preFac = symmetryFactor() * gaugeFactor();
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip,
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)/m2dip,
                       pT2/m2dip);
 
   unordered_map<string,double> wts;
@@ -7017,7 +7017,7 @@ double Dire_fsr_qcd_G2GG_notPartial::zSplit(double zMinAbs, double,
   double m2dip) {
   // Just pick according to soft.
   double R         = rndmPtr->flat();
-  double kappaMin4 = pow4(settingsPtr->parm("TimeShower:pTmin"))/pow2(m2dip);
+  double kappaMin4 = pow4(pTminFSRPtr->valNow)/pow2(m2dip);
   double p         = pow( 1. + pow2(1-zMinAbs)/kappaMin4, R );
   double res       = 1. - sqrt( p - 1. )*sqrt(kappaMin4);
   return res;
@@ -7029,7 +7029,7 @@ double Dire_fsr_qcd_G2GG_notPartial::overestimateInt(double zMinAbs, double,
 
   // Overestimate by soft
   double preFac    = symmetryFactor() * gaugeFactor();
-  double kappaMin4 = pow4(settingsPtr->parm("TimeShower:pTmin"))/pow2(m2dip);
+  double kappaMin4 = pow4(pTminFSRPtr->valNow)/pow2(m2dip);
   double wt        = preFac * 0.5 * log( 1. + pow2(1.-zMinAbs)/kappaMin4);
   return wt;
 }
@@ -7039,7 +7039,7 @@ double Dire_fsr_qcd_G2GG_notPartial::overestimateDiff(double z, double m2dip,
   int) {
   // Overestimate by soft
   double preFac    = symmetryFactor() * gaugeFactor();
-  double kappaMin4 = pow4(settingsPtr->parm("TimeShower:pTmin"))/pow2(m2dip);
+  double kappaMin4 = pow4(pTminFSRPtr->valNow)/pow2(m2dip);
   double wt        = preFac * (1.-z) / ( pow2(1.-z) + kappaMin4);
   return wt;
 }
@@ -7060,7 +7060,7 @@ bool Dire_fsr_qcd_G2GG_notPartial::calc(const Event& state, int) {
   int splitType(splitInfo.type);
 
   double preFac = symmetryFactor() * gaugeFactor();
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))/m2dip,
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)/m2dip,
                       pT2/m2dip);
 
   // Calculate kernel.
@@ -7235,7 +7235,7 @@ bool Dire_fsr_qcd_G2QQ_notPartial::calc(const Event& state, int) {
   int splitType(splitInfo.type);
 
   double preFac = symmetryFactor() * gaugeFactor();
-  double kappa2 = max(pow2(settingsPtr->parm("TimeShower:pTmin"))
+  double kappa2 = max(pow2(pTminFSRPtr->valNow)
                       /m2dip, pT2/m2dip);
 
   unordered_map<string,double> wts;
@@ -267,7 +267,9 @@ void DireTimes::init( BeamParticle* beamAPtrIn,
   gammaW             = particleDataPtr->mWidth(24);
 
   nFinalMax          = settingsPtr->mode("DireTimes:nFinalMax");
+  nFinalMaxPtr       = settingsPtr->modePtr("DireTimes:nFinalMax");
   usePDFmasses       = settingsPtr->flag("ShowerPDF:usePDFmasses");
+  pSetPtr            = settingsPtr->wordPtr("PDF:pSet");
 
   // Mode for higher-order kernels.
   kernelOrder        = settingsPtr->mode("DireTimes:kernelOrder");
@@ -1809,10 +1811,11 @@ double DireTimes::pTnext( Event& event, double pTbegAll, double pTendAll,
     DireTimesEnd& dip = dipEnd[iDip];
 
     // Limit final state multiplicity. For debugging only
-    int nfmax = settingsPtr->mode("DireTimes:nFinalMax");
+    int nfmax = nFinalMaxPtr->valNow;
     int nFinal = 0;
-    for (int i=0; i < event.size(); ++i)
-      if (event[i].isFinal()) nFinal++;
+    if (nfmax > -10)
+      for (int i=0; i < event.size(); ++i)
+        if (event[i].isFinal()) nFinal++;
     if (nfmax > -10 && nFinal > nfmax) continue;
 
     // Dipole properties.
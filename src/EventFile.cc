@@ -0,0 +1,498 @@
+// EventFile.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Function definitions (not found in the header) for the ParticleView,
+// EventFileWriter and EventFileReader classes.
+
+#include "Pythia8/EventFile.h"
+#include "Pythia8/Streams.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// Layout of the file, common to writer and reader.
+
+// The file starts with a header of FILEHEADERSIZE bytes: the MAGIC
+// string, the format VERSION, the BYTEORDER check value, the sizes of the
+// particle and junction records, the number of weight names and the total
+// size of the header including the names. Each name is stored as its
+// length followed by the characters, and the header is padded to a
+// multiple of eight bytes.
+
+// Each event is stored as an EventFileRecord with the size of the full
+// record, the number of particles, junctions and weights, and the scales,
+// followed by the weights, the particle records and the junction records.
+
+namespace {
+
+struct EventFileRecord {
+  uint64_t recordSize;
+  uint32_t nParticles, nJunctions, nWeights, unused;
+  double   scale, scaleSecond;
+};
+
+const char     MAGIC[8]       = {'P', 'Y', '8', 'E', 'V', 'E', 'N', 'T'};
+const uint32_t VERSION        = 1;
+const uint32_t BYTEORDER      = 0x01020304;
+const size_t   FILEHEADERSIZE = 32;
+
+// Round up to a multiple of eight bytes.
+size_t pad8(size_t n) {return (n + 7) & ~size_t(7);}
+
+}
+
+//==========================================================================
+
+// The ParticleView class.
+
+//--------------------------------------------------------------------------
+
+// Create a full Particle object from the stored information.
+
+Particle ParticleView::particle() const {
+
+  Particle pt( recordPtr->id, recordPtr->status, recordPtr->mother1,
+    recordPtr->mother2, recordPtr->daughter1, recordPtr->daughter2,
+    recordPtr->col, recordPtr->acol, recordPtr->px, recordPtr->py,
+    recordPtr->pz, recordPtr->e, recordPtr->m, recordPtr->scale,
+    recordPtr->pol);
+  if (recordPtr->hasVertex != 0) pt.vProd( recordPtr->xProd,
+    recordPtr->yProd, recordPtr->zProd, recordPtr->tProd);
+  pt.tau(recordPtr->tau);
+  return pt;
+
+}
+
+//==========================================================================
+
+// The EventFileWriter class.
+
+//--------------------------------------------------------------------------
+
+// Open a new file, optionally compressed.
+
+bool EventFileWriter::open(string fileName, bool compress) {
+
+  // Close any previous file.
+  close();
+  headerDone  = false;
+  nEventsSave = 0;
+
+  // Open plain or compressed stream.
+  if (compress) {
+#ifdef GZIP
+    osPtr = new ogzstream(fileName.c_str());
+#else
+    if (loggerPtr) loggerPtr->ERROR_MSG(
+      "compression requires the library to be built with zlib");
+    return false;
+#endif
+  } else osPtr = new ofstream(fileName.c_str(), ios::out | ios::binary);
+  if (!osPtr->good()) {
+    if (loggerPtr) loggerPtr->ERROR_MSG("could not open file", fileName);
+    delete osPtr;
+    osPtr = nullptr;
+    return false;
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write an event, with the weights and weight names from Info.
+
+bool EventFileWriter::write(const Event& event, const Info& info) {
+
+  return write( event, info.weightValueVector(), info.weightNameVector());
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write an event, with weights. The weight names are only used for the
+// first event, where they are stored in the file header.
+
+bool EventFileWriter::write(const Event& event,
+  const vector<double>& weights, const vector<string>& weightNames) {
+
+  if (osPtr == nullptr) return false;
+
+  // Set up the record in a local buffer, outside of the lock.
+  int nPart = event.size();
+  int nJun  = event.sizeJunction();
+  int nWgt  = weights.size();
+  size_t recordSize = sizeof(EventFileRecord) + nWgt * sizeof(double)
+    + nPart * sizeof(EventFileParticle) + nJun * sizeof(EventFileJunction);
+  vector<char> buffer(recordSize, 0);
+  EventFileRecord* recordPtr = reinterpret_cast<EventFileRecord*>(&buffer[0]);
+  recordPtr->recordSize  = recordSize;
+  recordPtr->nParticles  = nPart;
+  recordPtr->nJunctions  = nJun;
+  recordPtr->nWeights    = nWgt;
+  recordPtr->scale       = event.scale();
+  recordPtr->scaleSecond = event.scaleSecond();
+  double* wgtPtr = reinterpret_cast<double*>(recordPtr + 1);
+  for (int i = 0; i < nWgt; ++i) wgtPtr[i] = weights[i];
+
+  // Particles.
+  EventFileParticle* partPtr
+    = reinterpret_cast<EventFileParticle*>(wgtPtr + nWgt);
+  for (int i = 0; i < nPart; ++i) {
+    const Particle& pt   = event[i];
+    EventFileParticle& rec = partPtr[i];
+    rec.id        = pt.id();
+    rec.status    = pt.status();
+    rec.mother1   = pt.mother1();
+    rec.mother2   = pt.mother2();
+    rec.daughter1 = pt.daughter1();
+    rec.daughter2 = pt.daughter2();
+    rec.col       = pt.col();
+    rec.acol      = pt.acol();
+    rec.hasVertex = (pt.hasVertex()) ? 1 : 0;
+    rec.px        = pt.px();
+    rec.py        = pt.py();
+    rec.pz        = pt.pz();
+    rec.e         = pt.e();
+    rec.m         = pt.m();
+    rec.scale     = pt.scale();
+    rec.pol       = pt.pol();
+    rec.xProd     = pt.xProd();
+    rec.yProd     = pt.yProd();
+    rec.zProd     = pt.zProd();
+    rec.tProd     = pt.tProd();
+    rec.tau       = pt.tau();
+  }
+
+  // Junctions.
+  EventFileJunction* junPtr
+    = reinterpret_cast<EventFileJunction*>(partPtr + nPart);
+  for (int i = 0; i < nJun; ++i) {
+    const Junction& ju = event.getJunction(i);
+    junPtr[i].remains = (ju.remains()) ? 1 : 0;
+    junPtr[i].kind    = ju.kind();
+    for (int j = 0; j < 3; ++j) {
+      junPtr[i].col[j]    = ju.col(j);
+      junPtr[i].endCol[j] = ju.endCol(j);
+      junPtr[i].status[j] = ju.status(j);
+    }
+  }
+
+  // Write file header before the first event.
+  lock_guard<mutex> lock(writeMutex);
+  if (!headerDone) writeHeader(weightNames);
+
+  // Write the event.
+  osPtr->write(&buffer[0], recordSize);
+  if (!osPtr->good()) {
+    if (loggerPtr) loggerPtr->ERROR_MSG("failed to write event");
+    return false;
+  }
+  ++nEventsSave;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Close the file. Write the header if no events were written.
+
+void EventFileWriter::close() {
+
+  if (osPtr == nullptr) return;
+  lock_guard<mutex> lock(writeMutex);
+  if (!headerDone) writeHeader( vector<string>() );
+  osPtr->flush();
+  delete osPtr;
+  osPtr = nullptr;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write the file header, including the weight names.
+
+void EventFileWriter::writeHeader(const vector<string>& weightNames) {
+
+  size_t headerSize = FILEHEADERSIZE;
+  for (const string& name : weightNames)
+    headerSize += sizeof(uint32_t) + name.size();
+  headerSize = pad8(headerSize);
+  vector<char> header(headerSize, 0);
+  memcpy(&header[0], MAGIC, 8);
+  uint32_t headerOut[6] = { VERSION, BYTEORDER,
+    uint32_t(sizeof(EventFileParticle)), uint32_t(sizeof(EventFileJunction)),
+    uint32_t(weightNames.size()), uint32_t(headerSize) };
+  memcpy(&header[8], headerOut, sizeof(headerOut));
+  size_t iByte = FILEHEADERSIZE;
+  for (const string& name : weightNames) {
+    uint32_t length = name.size();
+    memcpy(&header[iByte], &length, sizeof(uint32_t));
+    iByte += sizeof(uint32_t);
+    memcpy(&header[iByte], name.data(), length);
+    iByte += length;
+  }
+  osPtr->write(&header[0], headerSize);
+  headerDone = true;
+
+}
+
+//==========================================================================
+
+// The EventFileReader class.
+
+//--------------------------------------------------------------------------
+
+// Open a file and index the events in it.
+
+bool EventFileReader::open(string fileName) {
+
+  // Release any previous file.
+  close();
+
+  // Check whether the file is compressed, from the gzip magic number.
+  ifstream is(fileName.c_str(), ios::in | ios::binary);
+  if (!is.good()) {
+    if (loggerPtr) loggerPtr->ERROR_MSG("could not open file", fileName);
+    return false;
+  }
+  unsigned char magicIn[2] = {0, 0};
+  is.read(reinterpret_cast<char*>(magicIn), 2);
+  is.close();
+  bool isGzip = (magicIn[0] == 0x1f && magicIn[1] == 0x8b);
+
+  // Compressed file: decompress into memory.
+  if (isGzip) {
+#ifdef GZIP
+    igzstream gis(fileName.c_str());
+    const size_t CHUNK = 1 << 20;
+    size_t nRead = 0;
+    while (gis.good()) {
+      buffer.resize(nRead + CHUNK);
+      gis.read(&buffer[nRead], CHUNK);
+      nRead += gis.gcount();
+    }
+    buffer.resize(nRead);
+    dataPtr  = buffer.data();
+    dataSize = buffer.size();
+#else
+    if (loggerPtr) loggerPtr->ERROR_MSG(
+      "reading compressed files requires the library to be built with zlib");
+    return false;
+#endif
+
+  // Plain file: map it into memory.
+  } else {
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    struct stat fileStat;
+    if (fd < 0 || fstat(fd, &fileStat) != 0 || fileStat.st_size == 0) {
+      if (fd >= 0) ::close(fd);
+      if (loggerPtr) loggerPtr->ERROR_MSG("could not map file", fileName);
+      return false;
+    }
+    dataSize = fileStat.st_size;
+    void* mapPtr = mmap(nullptr, dataSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (mapPtr == MAP_FAILED) {
+      dataSize = 0;
+      if (loggerPtr) loggerPtr->ERROR_MSG("could not map file", fileName);
+      return false;
+    }
+    dataPtr = static_cast<const char*>(mapPtr);
+    mapped  = true;
+  }
+
+  // Read header and index events.
+  if (!readIndex()) {
+    if (loggerPtr) loggerPtr->ERROR_MSG("not a valid event file", fileName);
+    close();
+    return false;
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Release the file.
+
+void EventFileReader::close() {
+
+  if (mapped) munmap(const_cast<char*>(dataPtr), dataSize);
+  vector<char>().swap(buffer);
+  dataPtr  = nullptr;
+  dataSize = 0;
+  mapped   = false;
+  weightNamesSave.clear();
+  offsets.clear();
+  rewind();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Move to a given event.
+
+bool EventFileReader::goTo(long iEventIn) {
+
+  if (iEventIn < 0 || iEventIn >= long(offsets.size())) {
+    iEventNow = offsets.size();
+    recordPtr = nullptr;
+    return false;
+  }
+  iEventNow = iEventIn;
+  recordPtr = dataPtr + offsets[iEventNow];
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Properties of the current event.
+
+int EventFileReader::size() const {
+  return (recordPtr == nullptr) ? 0
+    : reinterpret_cast<const EventFileRecord*>(recordPtr)->nParticles;
+}
+
+int EventFileReader::sizeJunction() const {
+  return (recordPtr == nullptr) ? 0
+    : reinterpret_cast<const EventFileRecord*>(recordPtr)->nJunctions;
+}
+
+double EventFileReader::scale() const {
+  return (recordPtr == nullptr) ? 0.
+    : reinterpret_cast<const EventFileRecord*>(recordPtr)->scale;
+}
+
+double EventFileReader::scaleSecond() const {
+  return (recordPtr == nullptr) ? 0.
+    : reinterpret_cast<const EventFileRecord*>(recordPtr)->scaleSecond;
+}
+
+int EventFileReader::nWeights() const {
+  return (recordPtr == nullptr) ? 0
+    : reinterpret_cast<const EventFileRecord*>(recordPtr)->nWeights;
+}
+
+//--------------------------------------------------------------------------
+
+// Weight of the current event.
+
+double EventFileReader::weight(int i) const {
+  return (i >= 0 && i < nWeights()) ? weights()[i] : 0.;
+}
+
+//--------------------------------------------------------------------------
+
+// Junction of the current event.
+
+Junction EventFileReader::junction(int i) const {
+
+  if (i < 0 || i >= sizeJunction()) return Junction();
+  const EventFileJunction& rec = junctions()[i];
+  Junction ju(rec.kind, rec.col[0], rec.col[1], rec.col[2]);
+  ju.remains(rec.remains != 0);
+  for (int j = 0; j < 3; ++j) {
+    ju.endCol(j, rec.endCol[j]);
+    ju.status(j, rec.status[j]);
+  }
+  return ju;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Copy the current event into an Event object.
+
+bool EventFileReader::fill(Event& event) const {
+
+  if (recordPtr == nullptr) return false;
+  event.clear();
+  const EventFileParticle* partPtr = particles();
+  for (int i = 0; i < size(); ++i)
+    event.append( ParticleView(partPtr + i).particle() );
+  for (int i = 0; i < sizeJunction(); ++i)
+    event.appendJunction( junction(i) );
+  event.scale( scale() );
+  event.scaleSecond( scaleSecond() );
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Locate the parts of the current event record.
+
+const double* EventFileReader::weights() const {
+  return reinterpret_cast<const double*>(recordPtr + sizeof(EventFileRecord));
+}
+
+const EventFileParticle* EventFileReader::particles() const {
+  return reinterpret_cast<const EventFileParticle*>(weights() + nWeights());
+}
+
+const EventFileJunction* EventFileReader::junctions() const {
+  return reinterpret_cast<const EventFileJunction*>(particles() + size());
+}
+
+//--------------------------------------------------------------------------
+
+// Read the file header and index the event records. A truncated last
+// record, e.g. from an interrupted run, is skipped.
+
+bool EventFileReader::readIndex() {
+
+  // Check the fixed part of the header.
+  if (dataSize < FILEHEADERSIZE || memcmp(dataPtr, MAGIC, 8) != 0)
+    return false;
+  uint32_t headerIn[6];
+  memcpy(headerIn, dataPtr + 8, sizeof(headerIn));
+  if (headerIn[0] != VERSION || headerIn[1] != BYTEORDER
+    || headerIn[2] != sizeof(EventFileParticle)
+    || headerIn[3] != sizeof(EventFileJunction)
+    || headerIn[5] > dataSize || headerIn[5] % 8 != 0) return false;
+
+  // Read weight names.
+  size_t iByte = FILEHEADERSIZE;
+  for (uint32_t iName = 0; iName < headerIn[4]; ++iName) {
+    uint32_t length;
+    if (iByte + sizeof(uint32_t) > headerIn[5]) return false;
+    memcpy(&length, dataPtr + iByte, sizeof(uint32_t));
+    iByte += sizeof(uint32_t);
+    if (iByte + length > headerIn[5]) return false;
+    weightNamesSave.push_back( string(dataPtr + iByte, length) );
+    iByte += length;
+  }
+
+  // Index the event records, checking that each is consistent.
+  iByte = headerIn[5];
+  while (iByte + sizeof(EventFileRecord) <= dataSize) {
+    const EventFileRecord* recPtr
+      = reinterpret_cast<const EventFileRecord*>(dataPtr + iByte);
+    size_t sizeNow = sizeof(EventFileRecord)
+      + recPtr->nWeights * sizeof(double)
+      + recPtr->nParticles * sizeof(EventFileParticle)
+      + recPtr->nJunctions * sizeof(EventFileJunction);
+    if (recPtr->recordSize != sizeNow) return false;
+    if (iByte + sizeNow > dataSize) {
+      if (loggerPtr) loggerPtr->WARNING_MSG("skipped truncated last event");
+      break;
+    }
+    offsets.push_back(iByte);
+    iByte += sizeNow;
+  }
+  return true;
+
+}
+
+//==========================================================================
+
+} // end namespace Pythia8
@@ -189,13 +189,7 @@ void StringFlav::init() {
   exponentNSP        = parm("ClosePacking:expNSP");
 
   // Save "vacuum" parameters for closepacking init() function.
-  probStoUDSav    = probStoUD;
-  probQQtoQSav    = probQQtoQ;
-  probSQtoQQSav   = probSQtoQQ;
-  probQQ1toQQ0Sav = probQQ1toQQ0;
-  alphaQQSav      = (1. + 2. * probSQtoQQ * probStoUD + 9. * probQQ1toQQ0
-    + 6. * probSQtoQQ * probQQ1toQQ0 * probStoUD
-    + 3. * probQQ1toQQ0 * pow2(probSQtoQQ * probStoUD)) / (2. + probStoUD);
+  saveVacuumParameters();
 
   // Calculate derived parameters.
   initDerived();
@@ -707,6 +701,29 @@ void StringFlav::init() {
 
 //--------------------------------------------------------------------------
 
+// Set the basic flavour and pT width parameters directly, as init() would
+// do had they been changed in the settings database.
+
+void StringFlav::setEffectiveParameters(double probStoUDIn,
+  double probSQtoQQIn, double probQQ1toQQ0In, double probQQtoQIn,
+  double sigmaIn) {
+
+  probQQtoQ       = probQQtoQIn;
+  probStoUD       = probStoUDIn;
+  probSQtoQQ      = probSQtoQQIn;
+  probQQ1toQQ0    = probQQ1toQQ0In;
+  sigmaHad        = sqrt(2.0) * sigmaIn;
+
+  // Save "vacuum" parameters for closepacking init() function.
+  saveVacuumParameters();
+
+  // Calculate derived parameters.
+  initDerived();
+
+}
+
+//--------------------------------------------------------------------------
+
 // Initialise parameters when using close packing.
 
 void StringFlav::init(double kappaRatio, double strangeFac, double probQQmod) {
@@ -1321,6 +1338,22 @@ int StringFlav::makeDiquark(int id1, int id2, int idHad) {
 
 //--------------------------------------------------------------------------
 
+// Save the current basic parameters as the "vacuum" ones.
+
+void StringFlav::saveVacuumParameters() {
+
+  probStoUDSav    = probStoUD;
+  probQQtoQSav    = probQQtoQ;
+  probSQtoQQSav   = probSQtoQQ;
+  probQQ1toQQ0Sav = probQQ1toQQ0;
+  alphaQQSav      = (1. + 2. * probSQtoQQ * probStoUD + 9. * probQQ1toQQ0
+    + 6. * probSQtoQQ * probQQ1toQQ0 * probStoUD
+    + 3. * probQQ1toQQ0 * pow2(probSQtoQQ * probStoUD)) / (2. + probStoUD);
+
+}
+
+//--------------------------------------------------------------------------
+
 // Initialise the derived parameters.
 
 void StringFlav::initDerived() {
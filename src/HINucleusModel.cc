@@ -205,6 +205,14 @@ vector<Nucleon> ExternalNucleusModel::generate() const {
 
 //--------------------------------------------------------------------------
 
+// Constants: could be changed here if desired, but normally should not.
+// These are of technical nature, as described for each.
+
+// Maximum number of cells along each side of the hard core cell grid.
+const int HardCoreModel::MAXCELLSIDE = 32;
+
+//--------------------------------------------------------------------------
+
 // Init the hard core parameters. To be called in init() in derived classes.
 void HardCoreModel::initHardCore() {
   useHardCore = (isProj ? settingsPtr->flag("HeavyIonA:HardCore")
@@ -213,6 +221,135 @@ void HardCoreModel::initHardCore() {
                            : settingsPtr->parm("HeavyIonB:HardCoreRadius"));
   gaussHardCore = (isProj ? settingsPtr->flag("HeavyIonA:GaussHardCore")
                           : settingsPtr->flag("HeavyIonB:GaussHardCore"));
+  nPool = (isProj ? settingsPtr->mode("HeavyIonA:ConfigPool")
+                  : settingsPtr->mode("HeavyIonB:ConfigPool"));
+  poolSave.clear();
+}
+
+//--------------------------------------------------------------------------
+
+// Generate all nucleons in a nucleus. Either generate new positions, or
+// pick a configuration from the pool, filled when first used or when
+// the nucleus has changed, and give it a random orientation.
+
+vector<Nucleon> HardCoreModel::generate() const {
+  int sign = id() > 0? 1: -1;
+  int pid = sign*2212;
+  int nid = sign*2112;
+  vector<Nucleon> nucleons;
+
+  if ( A() == 0 ) {
+    nucleons.push_back(Nucleon(id(), 0, Vec4()));
+    return nucleons;
+  }
+  if ( A() == 1 ) {
+    if ( Z() == 1 ) nucleons.push_back(Nucleon(pid, 0, Vec4()));
+    else  nucleons.push_back(Nucleon(nid, 0, Vec4()));
+    return nucleons;
+  }
+
+  vector<Vec4> positions;
+  if ( nPool > 0 ) {
+    if ( int(poolSave.size()) != nPool || int(poolSave[0].size()) != A() ) {
+      poolSave.clear();
+      for ( int i = 0; i < nPool; ++i )
+        poolSave.push_back(generatePositions());
+    }
+    positions = poolSave[min(nPool - 1, int(rndmPtr->flat()*nPool))];
+    double psi = 2.0*M_PI*rndmPtr->flat();
+    double the = acos(2.0*rndmPtr->flat() - 1.0);
+    double phi = 2.0*M_PI*rndmPtr->flat();
+    for ( Vec4& pos : positions ) {
+      pos.rot(0.0, psi);
+      pos.rot(the, phi);
+    }
+  } else
+    positions = generatePositions();
+
+  nucleons.resize(A());
+  int Np = Z();
+  int Nn = A() - Z();
+  for ( int i = 0, N = positions.size(); i < N; ++i ) {
+    Vec4 pos(positions[i].px(), positions[i].py());
+    if ( int(rndmPtr->flat()*(Np + Nn)) >= Np ) {
+      --Nn;
+      nucleons[i] = Nucleon(nid, i, pos);
+    } else {
+      --Np;
+      nucleons[i] = Nucleon(pid, i, pos);
+    }
+  }
+  return nucleons;
+}
+
+//--------------------------------------------------------------------------
+
+// Generate the positions of all nucleons, rejecting those that overlap
+// with the hard core of earlier ones, and shift them to their centre.
+
+vector<Vec4> HardCoreModel::generatePositions() const {
+
+  // For a fixed-radius hard core, set up cells covering the nucleus.
+  bool useCells = useHardCore && !gaussHardCore && hardCoreRadius > 0.0;
+  if ( useCells ) {
+    double rGrid = max(R(), 1.2*pow(double(A()), 1.0/3.0)) + hardCoreRadius;
+    nCellSide = max(1, min(MAXCELLSIDE, int(2.0*rGrid/hardCoreRadius)));
+    cellSize = 2.0*rGrid/nCellSide;
+    cellMin = -rGrid;
+    cellFirst.assign(nCellSide*nCellSide*nCellSide, -1);
+    cellNext.clear();
+  }
+
+  Vec4 cms;
+  vector<Vec4> positions;
+  while ( int(positions.size()) < A() ) {
+    Vec4 pos = generateNucleon();
+    if ( overlaps(positions, pos) ) continue;
+    if ( useCells ) {
+      int iCell = cellIndex(pos);
+      cellNext.push_back(cellFirst[iCell]);
+      cellFirst[iCell] = positions.size();
+    }
+    positions.push_back(pos);
+    cms += pos;
+  }
+
+  cms /= A();
+  for ( Vec4& pos : positions ) pos -= cms;
+  return positions;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Check if a new nucleon overlaps with the hard core of earlier ones.
+// For a fixed-radius hard core only the neighbouring cells are checked.
+
+bool HardCoreModel::overlaps(const vector<Vec4>& positions,
+  const Vec4& pos) const {
+
+  if ( !useHardCore ) return false;
+
+  // A Gaussian hard core gets a new radius for each earlier nucleon.
+  if ( gaussHardCore ) {
+    for ( int i = 0, N = positions.size(); i < N; ++i )
+      if ( (positions[i] - pos).pAbs() < rSample() ) return true;
+    return false;
+  }
+  if ( hardCoreRadius <= 0.0 ) return false;
+
+  // Loop over the neighbouring cells and the nucleons in them.
+  int ix = cellCoord(pos.px());
+  int iy = cellCoord(pos.py());
+  int iz = cellCoord(pos.pz());
+  for ( int jz = max(0, iz - 1); jz <= min(nCellSide - 1, iz + 1); ++jz )
+  for ( int jy = max(0, iy - 1); jy <= min(nCellSide - 1, iy + 1); ++jy )
+  for ( int jx = max(0, ix - 1); jx <= min(nCellSide - 1, ix + 1); ++jx )
+    for ( int i = cellFirst[(jz*nCellSide + jy)*nCellSide + jx]; i >= 0;
+          i = cellNext[i] )
+      if ( (positions[i] - pos).pAbs() < hardCoreRadius ) return true;
+  return false;
+
 }
 
 //==========================================================================
@@ -263,62 +400,6 @@ Vec4 WoodsSaxonModel::generateNucleon() const {
   return Vec4();
 }
 
-//--------------------------------------------------------------------------
-
-// Generate all nucleons in a nucleus.
-
-vector<Nucleon> WoodsSaxonModel::generate() const {
-  int sign = id() > 0? 1: -1;
-  int pid = sign*2212;
-  int nid = sign*2112;
-  vector<Nucleon> nucleons;
-
-  if ( A() == 0 ) {
-    nucleons.push_back(Nucleon(id(), 0, Vec4()));
-    return nucleons;
-  }
-  if ( A() == 1 ) {
-    if ( Z() == 1 ) nucleons.push_back(Nucleon(pid, 0, Vec4()));
-    else  nucleons.push_back(Nucleon(nid, 0, Vec4()));
-    return nucleons;
-  }
-
-  Vec4 cms;
-  vector<Vec4> positions;
-  while ( int(positions.size()) < A() ) {
-    while ( true ) {
-      Vec4 pos = generateNucleon();
-      bool overlap = false;
-      if (useHardCore) {
-        for (int i = 0, N = positions.size(); i < N && !overlap; ++i ) {
-          if ((positions[i] - pos).pAbs() < rSample() ) overlap = true;
-        }
-      }
-      if ( overlap ) continue;
-      positions.push_back(pos);
-      cms += pos;
-      break;
-    }
-  }
-
-  cms /= A();
-  nucleons.resize(A());
-  int Np = Z();
-  int Nn = A() - Z();
-  for ( int i = 0, N= positions.size(); i < N; ++i ) {
-    Vec4 pos(positions[i].px() - cms.px(),
-                 positions[i].py() - cms.py());
-    if ( int(rndmPtr->flat()*(Np + Nn)) >= Np ) {
-      --Nn;
-      nucleons[i] = Nucleon(nid, i, pos);
-    } else {
-      --Np;
-      nucleons[i] = Nucleon(pid, i, pos);
-    }
-  }
-  return nucleons;
-}
-
 //==========================================================================
 
 // GLISSANDOModel is a special case of the WoodsSaxon model with specific
@@ -431,63 +512,6 @@ Vec4 HOShellModel::generateNucleon() const {
   return Vec4(r*sinthe*cos(phi), r*sinthe*sin(phi), r*costhe);
 }
 
-//--------------------------------------------------------------------------
-
-// Generate all the nucleons.
-
-vector<Nucleon> HOShellModel::generate() const {
-  int sign = id() > 0? 1: -1;
-  int pid = sign*2212;
-  int nid = sign*2112;
-  vector<Nucleon> nucleons;
-
-  if ( A() == 0 ) {
-    nucleons.push_back(Nucleon(id(), 0, Vec4()));
-    return nucleons;
-  }
-  if ( A() == 1 ) {
-    if ( Z() == 1 ) nucleons.push_back(Nucleon(pid, 0, Vec4()));
-    else  nucleons.push_back(Nucleon(nid, 0, Vec4()));
-    return nucleons;
-  }
-
-  Vec4 cms;
-  vector<Vec4> positions;
-  while ( int(positions.size()) < A() ) {
-    while ( true ) {
-      Vec4 pos = generateNucleon();
-      bool overlap = false;
-      if (useHardCore) {
-        for ( int i = 0, N = positions.size(); i < N && !overlap; ++i ) {
-          if ( (positions[i] - pos).pAbs() < rSample() ) overlap = true;
-              }
-      }
-      if ( overlap ) continue;
-      positions.push_back(pos);
-      cms += pos;
-      break;
-    }
-  }
-
-  cms /= A();
-  nucleons.resize(A());
-  int Np = Z();
-  int Nn = A() - Z();
-  for ( int i = 0, N= positions.size(); i < N; ++i ) {
-    Vec4 pos(positions[i].px() - cms.px(),
-                 positions[i].py() - cms.py());
-    if ( int(rndmPtr->flat()*(Np + Nn)) >= Np ) {
-      --Nn;
-      nucleons[i] = Nucleon(nid, i, pos);
-    } else {
-      --Np;
-      nucleons[i] = Nucleon(pid, i, pos);
-    }
-  }
-
-  return nucleons;
-}
-
 //==========================================================================
 
 // The Hulthen model for deuterons.
@@ -570,8 +594,9 @@ bool GaussianModel::init() {
 
   if ( A() == 0 ) return true;
 
-  // Initialize hard core.
+  // Initialize hard core, which is always Gaussian in this model.
   initHardCore();
+  gaussHardCore = true;
 
   // A single parameter.
   nucleusChR = isProj ? settingsPtr->parm("HeavyIonA:GaussianChargeRadius")
@@ -597,63 +622,6 @@ Vec4 GaussianModel::generateNucleon() const {
   return Vec4(r*sinthe*cos(phi), r*sinthe*sin(phi), r*costhe);
 }
 
-//--------------------------------------------------------------------------
-
-// Generate all the nucleons.
-
-vector<Nucleon> GaussianModel::generate() const {
-  int sign = id() > 0? 1: -1;
-  int pid = sign*2212;
-  int nid = sign*2112;
-  vector<Nucleon> nucleons;
-
-  if ( A() == 0 ) {
-    nucleons.push_back(Nucleon(id(), 0, Vec4()));
-    return nucleons;
-  }
-  if ( A() == 1 ) {
-    if ( Z() == 1 ) nucleons.push_back(Nucleon(pid, 0, Vec4()));
-    else  nucleons.push_back(Nucleon(nid, 0, Vec4()));
-    return nucleons;
-  }
-
-  Vec4 cms;
-  vector<Vec4> positions;
-  while ( int(positions.size()) < A() ) {
-    while ( true ) {
-      Vec4 pos = generateNucleon();
-      bool overlap = false;
-      if (useHardCore) {
-        for ( int i = 0, N = positions.size(); i < N && !overlap; ++i )
-          if ( (positions[i] - pos).pAbs() < abs(rndmPtr->gauss())
-             * hardCoreRadius )
-            overlap = true;
-      }
-      if ( overlap ) continue;
-      positions.push_back(pos);
-      cms += pos;
-      break;
-    }
-  }
-
-  cms /= A();
-  nucleons.resize(A());
-  int Np = Z();
-  int Nn = A() - Z();
-  for ( int i = 0, N = positions.size(); i < N; ++i ) {
-    Vec4 pos(positions[i].px() - cms.px(), positions[i].py() - cms.py());
-    if ( int(rndmPtr->flat()*(Np + Nn)) >= Np ) {
-      --Nn;
-      nucleons[i] = Nucleon(nid, i, pos);
-    } else {
-      --Np;
-      nucleons[i] = Nucleon(pid, i, pos);
-    }
-  }
-
-  return nucleons;
-}
-
 //==========================================================================
 
 // ClusterModel generates nucleons clustered in smaller nucleons.
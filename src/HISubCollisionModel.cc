@@ -82,15 +82,18 @@ Vec4 ImpactParameterGenerator::generate(double & weight) const {
 //--------------------------------------------------------------------------
 
 shared_ptr<SubCollisionModel> SubCollisionModel::create(int model) {
+  shared_ptr<SubCollisionModel> modelPtr;
   switch (model) {
-    case 0: return make_shared<NaiveSubCollisionModel>();
-    case 1: return make_shared<DoubleStrikmanSubCollisionModel>();
-    case 2: return make_shared<DoubleStrikmanSubCollisionModel>(1);
-    case 3: return make_shared<BlackSubCollisionModel>();
-    case 4: return make_shared<LogNormalSubCollisionModel>();
-    case 5: return make_shared<LogNormalSubCollisionModel>(1);
+    case 0: modelPtr = make_shared<NaiveSubCollisionModel>(); break;
+    case 1: modelPtr = make_shared<DoubleStrikmanSubCollisionModel>(); break;
+    case 2: modelPtr = make_shared<DoubleStrikmanSubCollisionModel>(1); break;
+    case 3: modelPtr = make_shared<BlackSubCollisionModel>(); break;
+    case 4: modelPtr = make_shared<LogNormalSubCollisionModel>(); break;
+    case 5: modelPtr = make_shared<LogNormalSubCollisionModel>(1); break;
     default: return nullptr;
   }
+  modelPtr->modelSave = model;
+  return modelPtr;
 }
 
 //--------------------------------------------------------------------------
@@ -111,6 +114,8 @@ bool SubCollisionModel::init(int idAIn, int idBIn, double eCMIn) {
   sigErr = settingsPtr->pvec("HeavyIon:SigFitErr");
   sigFuzz = settingsPtr->parm("HeavyIon:SigFitFuzz");
   fitPrint = settingsPtr->flag("HeavyIon:SigFitPrint");
+  doParallelFit = settingsPtr->flag("HeavyIon:SigFitParallel");
+  nThreadsFit = settingsPtr->mode("HeavyIon:SigFitNThreads");
   impactFudge = settingsPtr->parm("Angantyr:impactFudge");
   doVarECM = settingsPtr->flag("Beams:allowVariableEnergy");
   doVarBeams = settingsPtr->flag("Beams:allowIDASwitch");
@@ -579,11 +584,11 @@ bool SubCollisionModel::evolve(int nGenerations, double eCM) {
     // Calculate Chi2 for each parameter set and order them.
     multimap<double, Parms> chi2map;
     double chi2max = 0.0;
+    vector<double> chi2Pop;
+    calcChi2Pop(pop, chi2Pop);
     for ( int i = 0; i < NPop; ++i ) {
-      setParm(pop[i]);
-      double chi2 = Chi2(getSig(), dim);
-      chi2map.insert(make_pair(chi2, pop[i]));
-      chi2max = max(chi2max, chi2);
+      chi2map.insert(make_pair(chi2Pop[i], pop[i]));
+      chi2max = max(chi2max, chi2Pop[i]);
     }
 
     if (fitPrint) {
@@ -678,6 +683,56 @@ bool SubCollisionModel::evolve(int nGenerations, double eCM) {
 
 }
 
+//--------------------------------------------------------------------------
+
+// Calculate the Chi2 for each parameter set in a population. Normally
+// done in order, with the main random number generator. In parallel mode
+// each parameter set instead gets its own generator, seeded in order from
+// the main one, and the sets are shared out among threads that each own a
+// copy of the model. The fit then does not depend on the number of threads.
+
+void SubCollisionModel::calcChi2Pop(const vector< vector<double> >& pop,
+  vector<double>& chi2Pop) {
+
+  int nPop = pop.size();
+  int dim  = nParms();
+  chi2Pop.resize(nPop);
+
+  // Serial evaluation, also for models not made by create().
+  if (!doParallelFit || modelSave < 0) {
+    for (int i = 0; i < nPop; ++i) {
+      setParm(pop[i]);
+      chi2Pop[i] = Chi2(getSig(), dim);
+    }
+    return;
+  }
+
+  // Seeds for the parameter sets.
+  vector<int> seeds(nPop);
+  for (int i = 0; i < nPop; ++i) seeds[i] = rndmPtr->newSeed();
+
+  // A copy of the model, with its own generator, for each thread.
+  int nThreads = min(threadCount(nThreadsFit), nPop);
+  vector< shared_ptr<SubCollisionModel> > copyPtrs(nThreads);
+  vector<Rndm> rndms(nThreads);
+  for (int iThread = 0; iThread < nThreads; ++iThread) {
+    copyPtrs[iThread] = create(modelSave);
+    copyPtrs[iThread]->sigTarg   = sigTarg;
+    copyPtrs[iThread]->sigErr    = sigErr;
+    copyPtrs[iThread]->NInt      = NInt;
+    copyPtrs[iThread]->rndmPtr   = &rndms[iThread];
+    copyPtrs[iThread]->loggerPtr = loggerPtr;
+  }
+
+  // Each thread picks the next parameter set until all are done.
+  parallelFor(nPop, nThreads, [&](int iThread, int i) {
+    rndms[iThread].init(seeds[i]);
+    copyPtrs[iThread]->setParm(pop[i]);
+    chi2Pop[i] = copyPtrs[iThread]->Chi2(copyPtrs[iThread]->getSig(), dim);
+  });
+
+}
+
 //==========================================================================
 
 // The BlackSubCollisionModel uses fixed size, black-disk
@@ -49,6 +49,14 @@ public:
 // Small safety mass used in string-end rapidity calculations.
 const double HadronLevel::MTINY = 0.1;
 
+// Minimal relative size of the Gram determinant of two hadron momenta,
+// below which the invariant impact-parameter check is not used.
+const double HadronLevel::GRAMMINRESC = 1e-6;
+
+// Safety margin, relative to the size of the terms involved, by which the
+// invariant impact parameter must exceed bMax to reject a pair.
+const double HadronLevel::B2MARGINRESC = 1e-6;
+
 //--------------------------------------------------------------------------
 
 // Find settings. Initialize HadronLevel classes as required.
@@ -695,29 +703,46 @@ bool HadronLevel::rescatter(Event& event) {
 void HadronLevel::queueDecResc(Event& event, int iStart,
   priority_queue<HadronLevel::PriorityNode>& queue) {
 
-  // Loop over all existing or newly added hadrons.
-  for (int iFirst = iStart; iFirst < event.size(); ++iFirst) {
+  // Update the list of hadrons that may rescatter. Hadrons are only added
+  // at the end of the event record, and hadrons that have interacted are
+  // no longer final, so the existing list only needs to be thinned.
+  if (iStart == 0) {
+    iRescatter.clear();
+    iPrimaryRescatter.clear();
+  } else iRescatter.erase( remove_if( iRescatter.begin(), iRescatter.end(),
+    [&event](int i) { return !event[i].isFinal(); }), iRescatter.end());
+  int iFirstNew = iRescatter.size();
+  for (int i = iStart; i < event.size(); ++i)
+    if (event[i].isFinal() && event[i].isHadron() && !event[i].isExotic())
+      iRescatter.push_back(i);
+
+  // Find primary hadron mother, if any, for the new entries.
+  for (int i = iPrimaryRescatter.size(); i < event.size(); ++i) {
+    int iNow = i;
+    int iMot = event[iNow].mother1();
+    if (!scatterNeighbours)
+    while (event[iMot].isHadron() && event[iNow].mother2() == 0) {
+      iNow = iMot;
+      iMot = event[iNow].mother1();
+    }
+    iPrimaryRescatter.push_back(iNow);
+  }
+
+  // Loop over all newly added hadrons.
+  for (int jFirst = iFirstNew; jFirst < int(iRescatter.size()); ++jFirst) {
+    int iFirst = iRescatter[jFirst];
     Particle& hadA = event[iFirst];
-    if (!hadA.isFinal() || !hadA.isHadron() || hadA.isExotic()) continue;
 
     // Queue hadrons that should decay.
     if (doDecay && hadA.canDecay() && hadA.mayDecay()
       && hadA.mWidth() > widthSepRescatter)
       queue.push(PriorityNode(iFirst, hadA.vDec()));
-
-    // Find primary hadron mother, if any.
-    int iNowA = iFirst;
-    int iMotA = event[iNowA].mother1();
-    if (!scatterNeighbours)
-    while (event[iMotA].isHadron() && event[iNowA].mother2() == 0) {
-      iNowA = iMotA;
-      iMotA = event[iNowA].mother1();
-    }
+    int iNowA = iPrimaryRescatter[iFirst];
 
     // Loop over a second existing hadron to study all pairs.
-    for (int iSecond = 0; iSecond < iFirst; ++iSecond) {
+    for (int jSecond = 0; jSecond < jFirst; ++jSecond) {
+      int iSecond = iRescatter[jSecond];
       Particle& hadB = event[iSecond];
-      if (!hadB.isFinal() || !hadB.isHadron() || hadB.isExotic()) continue;
 
       // Early skip if particles are moving away from each other.
       if (scatterQuickCheck && dot3( hadB.p() / hadB.e() - hadA.p() / hadA.e(),
@@ -727,18 +752,12 @@ void HadronLevel::queueDecResc(Event& event, int iStart,
       if ( event[hadA.mother1()].isHadron() && hadB.mother1() == hadA.mother1()
         && hadB.mother2() == hadA.mother2()) continue;
 
-      // Find primary hadron mother, if any.
-      if (!scatterNeighbours) {
-        int iNowB = iSecond;
-        int iMotB = event[iNowB].mother1();
-        while (event[iMotB].isHadron() && event[iNowB].mother2() == 0) {
-          iNowB = iMotB;
-          iMotB = event[iNowB].mother1();
-        }
+      // Optionally skip if primary hadron mothers are nearest neighbours.
+      if (!scatterNeighbours
+        && abs(iPrimaryRescatter[iSecond] - iNowA) <= 1) continue;
 
-        // Optionally skip if hadrons are nearest neighbours.
-        if (abs(iNowB - iNowA) <= 1) continue;
-      }
+      // Early skip of pairs with large impact parameter, before boosting.
+      if (outsideB2Max(hadA, hadB)) continue;
 
       // Set up positions for each particle in the pair CM frame.
       RotBstMatrix frame;
@@ -821,6 +840,44 @@ void HadronLevel::queueDecResc(Event& event, int iStart,
   }
 }
 
+//--------------------------------------------------------------------------
+
+// Check whether a pair surely has an impact parameter beyond bMax, without
+// boosting to the pair frame. The impact parameter is the part of the
+// separation of the production vertices that is orthogonal to the plane
+// spanned by the two momenta, which can be found from invariants. Pairs
+// close to the cut, or with almost equal velocities, are not rejected,
+// but left to the exact calculation in queueDecResc.
+
+bool HadronLevel::outsideB2Max(const Particle& hadA, const Particle& hadB) {
+
+  // Invariants of the two momenta, and the Gram determinant of the plane.
+  const Vec4& pA = hadA.p();
+  const Vec4& pB = hadB.p();
+  double m2A  = pA * pA;
+  double m2B  = pB * pB;
+  double pAB  = pA * pB;
+  double gram = pAB * pAB - m2A * m2B;
+  double eAB2 = pow2( (pA.e() + pA.pAbs()) * (pB.e() + pB.pAbs()) );
+  if (gram < GRAMMINRESC * eAB2) return false;
+
+  // Impact parameter squared from the projection of the separation.
+  Vec4 dv   = hadB.vProd() - hadA.vProd();
+  double cA = dv * pA;
+  double cB = dv * pB;
+  double b2 = -(cA * cA * m2B - 2. * cA * cB * pAB + cB * cB * m2A) / gram
+    - dv * dv;
+
+  // Compare with margin for rounding errors, from the size of the terms.
+  double dE2  = pow2( dv.e() ) + dv.pAbs2();
+  double eA   = pA.e() + pA.pAbs();
+  double eB   = pB.e() + pB.pAbs();
+  double size = dE2 * ( eA * eA * abs(m2B) + 2. * eA * eB * abs(pAB)
+    + eB * eB * abs(m2A) ) / gram + dE2;
+  return (b2 - b2Max > B2MARGINRESC * (size + b2Max));
+
+}
+
 //==========================================================================
 
 } // end namespace Pythia8
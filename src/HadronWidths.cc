@@ -63,6 +63,20 @@ bool HadronWidths::init(string path) {
     return false;
   }
 
+  // Reuse tables read from the same file by another instance, if possible.
+  // Resonances missing in the file are parameterized from the particle
+  // data, so the key also includes a hash of the particle data.
+  if (infoPtr->sharedTablesPtr) {
+    shared_ptr<const Tables> sharedPtr
+      = infoPtr->sharedTablesPtr->get<Tables>( "HadronWidths:" + path + ":"
+      + particleDataKey(), [&]() -> shared_ptr<const Tables> {
+        if (!init(stream)) return nullptr;
+        return tablesPtr.share(); });
+    if (!sharedPtr) return false;
+    tablesPtr.use(sharedPtr);
+    return true;
+  }
+
   return init(stream);
 }
 
@@ -72,6 +86,7 @@ bool HadronWidths::init(string path) {
 
 bool HadronWidths::init(istream& stream) {
 
+  Tables& tables = tablesPtr.writable();
   string line;
 
   while (getline(stream, line)) {
@@ -84,8 +99,9 @@ bool HadronWidths::init(istream& stream) {
       completeTag(stream, line);
 
       int id = intAttributeValue(line, "id");
-      auto entryIter = entries.find(id);
-      if (entryIter != entries.end() && entryIter->second.isUserDefined) {
+      auto entryIter = tables.entries.find(id);
+      if (entryIter != tables.entries.end()
+        && entryIter->second.isUserDefined) {
         loggerPtr->ERROR_MSG("resonance is defined more than once",
           std::to_string(id));
         continue;
@@ -102,16 +118,16 @@ bool HadronWidths::init(istream& stream) {
 
       // Insert resonance in entries
       LinearInterpolator widths(left, right, data);
-      entries.emplace(id, HadronWidthEntry{ widths, {}, false });
+      tables.entries.emplace(id, HadronWidthEntry{ widths, {}, false });
 
       // Insert resonance in signature map
       int signature = getSignature(particleDataPtr->isBaryon(id),
                                    particleDataPtr->chargeType(id));
 
-      auto iter = signatureToParticles.find(signature);
-      if (iter == signatureToParticles.end())
+      auto iter = tables.signatureToParticles.find(signature);
+      if (iter == tables.signatureToParticles.end())
         // If signature has not been used yet, insert a new vector into the map
-        signatureToParticles.emplace(signature, vector<int> { id });
+        tables.signatureToParticles.emplace(signature, vector<int> { id });
       else
         // If signature has been used already, add id to the existing vector
         iter->second.push_back(id);
@@ -121,8 +137,8 @@ bool HadronWidths::init(istream& stream) {
 
       int id = intAttributeValue(line, "id");
 
-      auto entryIter = entries.find(id);
-      if (entryIter == entries.end()) {
+      auto entryIter = tables.entries.find(id);
+      if (entryIter == tables.entries.end()) {
         loggerPtr->ERROR_MSG(
           "got partial width for a particle with undefined total width",
           std::to_string(id));
@@ -160,9 +176,9 @@ bool HadronWidths::init(istream& stream) {
   for (auto& pdtEntry : *particleDataPtr) {
     int id = pdtEntry.first;
     ParticleDataEntryPtr pdt = pdtEntry.second;
-    auto iter = entries.find(id);
+    auto iter = tables.entries.find(id);
     // Parameterize particle if it is not yet listed and has variable width.
-    if (iter == entries.end() && pdt->varWidth()) {
+    if (iter == tables.entries.end() && pdt->varWidth()) {
       // Check that has a resonance decay channel, i.e. into two hadrons.
       for (int iChannel = 0; iChannel < pdt->sizeChannels(); ++iChannel) {
         DecayChannel& channel = pdt->channel(iChannel);
@@ -189,9 +205,9 @@ bool HadronWidths::init(istream& stream) {
 bool HadronWidths::check() {
 
   // Check that all resonance entries make sense.
-  for (auto& entryPair : entries) {
+  for (auto& entryPair : tablesPtr->entries) {
     int id = entryPair.first;
-    HadronWidthEntry& entry = entryPair.second;
+    const HadronWidthEntry& entry = entryPair.second;
 
     // Check that entry id actually corresponds to a particle.
     if (!particleDataPtr->isParticle(id)) {
@@ -303,8 +319,8 @@ bool HadronWidths::hasResonances(int idA, int idB) const {
   int baryonNumber = entryA->isBaryon() + entryB->isBaryon();
   int charge = entryA->chargeType(idA) + entryB->chargeType(idB);
   int signature = getSignature(baryonNumber, charge);
-  auto iter = signatureToParticles.find(signature);
-  if (iter == signatureToParticles.end())
+  auto iter = tablesPtr->signatureToParticles.find(signature);
+  if (iter == tablesPtr->signatureToParticles.end())
     return false;
 
   // For resonances that matches signature, check that decay channel exists.
@@ -324,7 +340,7 @@ bool HadronWidths::hasResonances(int idA, int idB) const {
 
 set<int> HadronWidths::getResonances() const {
   set<int> resonances;
-  for (auto& p : entries) resonances.insert(p.first);
+  for (auto& p : tablesPtr->entries) resonances.insert(p.first);
   return resonances;
 }
 
@@ -345,8 +361,8 @@ set<int> HadronWidths::getResonances(int idA, int idB) const {
   int baryonNumber = entryA->isBaryon() + entryB->isBaryon();
   int charge = entryA->chargeType(idA) + entryB->chargeType(idB);
   int signature = getSignature(baryonNumber, charge);
-  auto iter = signatureToParticles.find(signature);
-  if (iter == signatureToParticles.end())
+  auto iter = tablesPtr->signatureToParticles.find(signature);
+  if (iter == tablesPtr->signatureToParticles.end())
     return set<int>();
 
   // For resonances that matches signature, check that decay channel exists.
@@ -376,8 +392,8 @@ bool HadronWidths::canDecay(int idR, int idA, int idB) const {
   // Get key and flip idR if necessary.
   pair<int, int> key = getKey(idR, idA, idB);
 
-  auto entryIter = entries.find(idR);
-  if (entryIter == entries.end())
+  auto entryIter = tablesPtr->entries.find(idR);
+  if (entryIter == tablesPtr->entries.end())
     return false;
 
   auto channelIter = entryIter->second.decayChannels.find(key);
@@ -406,8 +422,8 @@ double HadronWidths::width(int id, double m) const {
     return entry->mWidth();
 
   // For resonances, get width from parameterization.
-  auto iter = entries.find(abs(id));
-  if (iter == entries.end()) {
+  auto iter = tablesPtr->entries.find(abs(id));
+  if (iter == tablesPtr->entries.end()) {
     loggerPtr->WARNING_MSG("particle is resonance, but is not parameterized",
       to_string(id));
     return entry->mWidth();
@@ -440,8 +456,8 @@ double HadronWidths::partialWidth(int idR, int idA, int idB, double m) const {
     return particleDataPtr->mWidth(idR) * br(idR, idA, idB, m);
 
   // For resonances, get width from parameterization.
-  auto entryIter = entries.find(idR);
-  if (entryIter == entries.end()) {
+  auto entryIter = tablesPtr->entries.find(idR);
+  if (entryIter == tablesPtr->entries.end()) {
     loggerPtr->WARNING_MSG("particle is resonance, but is not parameterized",
       to_string(idR));
     return 0.;
@@ -491,8 +507,8 @@ double HadronWidths::br(int idR, int idA, int idB, double m) const {
   }
 
   // For resonances, get branching ratio from parameterization.
-  auto entryIter = entries.find(idR);
-  if (entryIter == entries.end()) {
+  auto entryIter = tablesPtr->entries.find(idR);
+  if (entryIter == tablesPtr->entries.end()) {
     loggerPtr->WARNING_MSG("particle is resonance, but is not parameterized",
       to_string(idR));
     return 0.;
@@ -543,15 +559,15 @@ bool HadronWidths::pickDecay(int idDec, double m, int& idAOut, int& idBOut,
   if (isAnti) idDec = -idDec;
 
   // Find table entry for decaying particle.
-  auto entriesIter = entries.find(idDec);
-  if (entriesIter == entries.end()) {
+  auto entriesIter = tablesPtr->entries.find(idDec);
+  if (entriesIter == tablesPtr->entries.end()) {
     loggerPtr->ERROR_MSG("particle is not parameterized", to_string(idDec));
     return false;
   }
-  HadronWidthEntry& entry = entriesIter->second;
+  const HadronWidthEntry& entry = entriesIter->second;
 
   // Get list of channels that are currently on.
-  vector<ResonanceDecayChannel*> channelsList;
+  vector<const ResonanceDecayChannel*> channelsList;
   vector<double> branchingRates;
   bool gotAny = false;
   for (auto& channel : entry.decayChannels) {
@@ -658,10 +674,10 @@ bool HadronWidths::pickMasses(int idA, int idB, double eCM,
   // Get width entries for particles with mass-depedent widths.
   bool hasVarWidthA = hasData(idA) && particleDataPtr->varWidth(idA);
   bool hasWidthA    = hasFixWidthA || hasVarWidthA;
-  HadronWidthEntry* entryA = nullptr;
+  const HadronWidthEntry* entryA = nullptr;
   if (hasVarWidthA) {
-    auto iterA = entries.find( abs(idA) );
-    if (iterA == entries.end()) {
+    auto iterA = tablesPtr->entries.find( abs(idA) );
+    if (iterA == tablesPtr->entries.end()) {
       loggerPtr->ERROR_MSG("mass distribution for particle is not defined",
         to_string(idA));
       return false;
@@ -670,10 +686,10 @@ bool HadronWidths::pickMasses(int idA, int idB, double eCM,
   }
   bool hasVarWidthB = hasData(idB) && particleDataPtr->varWidth(idB);
   bool hasWidthB    = hasFixWidthB || hasVarWidthB;
-  HadronWidthEntry* entryB = nullptr;
+  const HadronWidthEntry* entryB = nullptr;
   if (hasVarWidthB) {
-    auto iterB = entries.find( abs(idB) );
-    if (iterB == entries.end()) {
+    auto iterB = tablesPtr->entries.find( abs(idB) );
+    if (iterB == tablesPtr->entries.end()) {
       loggerPtr->ERROR_MSG("mass distribution for particle is not defined",
         to_string(idB));
       return false;
@@ -971,20 +987,21 @@ bool HadronWidths::parameterizeRecursive(int id, int precision) {
     partialWidths,
     true
   };
-  auto iter = entries.find(id);
-  if (iter == entries.end()) {
-    entries.emplace(id, newEntry);
+  Tables& tables = tablesPtr.writable();
+  auto iter = tables.entries.find(id);
+  if (iter == tables.entries.end()) {
+    tables.entries.emplace(id, newEntry);
 
     // If particle is new, insert it in signature index.
     int signature = getSignature(entry->isBaryon(), entry->chargeType(id));
-    auto signatureIter = signatureToParticles.find(signature);
-    if (signatureIter == signatureToParticles.end())
-      signatureToParticles.emplace(signature, vector<int> { id });
+    auto signatureIter = tables.signatureToParticles.find(signature);
+    if (signatureIter == tables.signatureToParticles.end())
+      tables.signatureToParticles.emplace(signature, vector<int> { id });
     else
       signatureIter->second.push_back(id);
   }
   else
-    entries[id] = newEntry;
+    tables.entries[id] = newEntry;
 
   // Done.
   return true;
@@ -1098,7 +1115,7 @@ void HadronWidths::parameterizeAll(int precision) {
   }
 
   // Clear existing data and parameterize new data.
-  entries.clear();
+  tablesPtr.writable().entries.clear();
 
   for (ParticleDataEntryPtr entry : variableWidthEntries) {
     loggerPtr->INFO_MSG("parameterizing resonance",
@@ -1121,7 +1138,7 @@ bool HadronWidths::save(ostream& stream) const {
 
   stream << "\n";
 
-  for (auto& mapEntry : entries) {
+  for (auto& mapEntry : tablesPtr->entries) {
     int id = mapEntry.first;
     const HadronWidthEntry& entry = mapEntry.second;
 
@@ -263,8 +263,8 @@ bool HeavyIons::isHeavyIon(Settings & settings) {
 
 Angantyr::Angantyr(Pythia & mainPythiaIn)
   : HeavyIons(mainPythiaIn), hasSignal(true),
-    collPtr(0), bGenPtr(0), projPtr(0), targPtr(0), recoilerMode(1), bMode(0),
-    doAbort(false) {
+    hasMBHooks(false), parallelND(false), collPtr(0), bGenPtr(0), projPtr(0),
+    targPtr(0), recoilerMode(1), bMode(0), doAbort(false) {
   selectMB = make_shared<ProcessSelectorHook>();
   selectSASD = make_shared<ProcessSelectorHook>();
   pythia.resize(ALL);
@@ -287,6 +287,7 @@ Angantyr::Angantyr(Pythia & mainPythiaIn)
 
 Angantyr::~Angantyr() {
   for ( int i = MBIAS; i < ALL; ++i ) if ( pythia[i] ) delete pythia[i];
+  for ( MBWorker& worker : mbWorkers ) delete worker.pythiaPtr;
 }
 
 //--------------------------------------------------------------------------
@@ -297,6 +298,7 @@ bool Angantyr::setUserHooksPtr(PythiaObject sel, shared_ptr<UserHooks> uhook) {
   for ( int i = HADRON; i < ALL; ++i )
     if ( ( i == sel || ALL == sel ) && !pythia[i]->setUserHooksPtr(uhook) )
       return false;
+  if ( sel == MBIAS || sel == ALL ) hasMBHooks = true;
   return true;
 }
 
@@ -332,6 +334,9 @@ bool Angantyr::setBeamIDs(int idAIn, int idBIn) {
 
   if (!pythia[MBIAS]->setBeamIDs(idANuc, idBNuc))
     return false;
+  for (MBWorker& worker : mbWorkers)
+    if (!worker.pythiaPtr->setBeamIDs(idANuc, idBNuc))
+      return false;
   if (!pythia[SASD]->setBeamIDs(idANuc, idBNuc))
     return false;
 
@@ -554,6 +559,14 @@ bool Angantyr::init() {
   pythia[MBIAS]->addUserHooksPtr(selectMB);
   init(MBIAS, "minimum bias processes");
 
+  // Optionally set up copies of it to generate sub-collisions in parallel.
+  parallelND = flag("Angantyr:parallelND") && !glauberOnly;
+  if ( parallelND && !initWorkers(mode("Angantyr:numThreads")) ) {
+    loggerPtr->ABORT_MSG("parallel minimum bias processes failed to "
+      "initialize");
+    return false;
+  }
+
   // Initialize subobject for secondary absorptive processes.
   clearProcessLevel(*pythia[SASD]);
   Settings & sdabsopts = pythia[SASD]->settings;
@@ -647,6 +660,14 @@ bool Angantyr::init() {
     if ( print )
       cout << " Angantyr Info: Initializing hadronisation processes." << endl;
   }
+
+  // Handles to settings that are read in each event.
+  allowVertexSpreadPtr = settingsPtr->flagPtr("Beams:allowVertexSpread");
+  sdTriesPtr = settingsPtr->modePtr( settingsPtr->isMode("HI:SDTries")
+    ? "HI:SDTries" : "Angantyr:SDTries");
+  eAPtr      = pythia[HADRON]->settings.parmPtr("Beams:eA");
+  eBPtr      = pythia[HADRON]->settings.parmPtr("Beams:eB");
+
   settingsPtr->flag("ProcessLevel:all", false);
   return true;
 
@@ -725,6 +746,114 @@ EventInfo Angantyr::getSASD(const SubCollision * coll, int procid) {
 
 //--------------------------------------------------------------------------
 
+// Generate non-diffractive events for a number of sub-collisions. With
+// Angantyr:parallelND the events are shared out among the worker copies
+// of the MBIAS object, if any, each event with a random number sequence
+// of its own. With the counter-based engine this is the one the event
+// would have had in the MBIAS object, and otherwise one started from a
+// seed of its own, as is the MBIAS object afterwards. The result then does
+// not depend on the number of threads, including when there is only one.
+// The events are returned in the order requested.
+
+vector<EventInfo> Angantyr::getNDs(
+  const vector<const SubCollision*>& collsIn) {
+
+  int nColl = collsIn.size();
+  vector<EventInfo> events(nColl);
+
+  // Generate the events one by one from the main sequence if not parallel.
+  if ( !parallelND ) {
+    for ( int i = 0; i < nColl; ++i )
+      events[i] = collsIn[i] ? getND(*collsIn[i]) : getND();
+    return events;
+  }
+
+  // The next event numbers of the MBIAS object with the counter-based
+  // engine, else seeds for the events and for the MBIAS object afterwards.
+  RndmState mbState = pythia[MBIAS]->rndm.getState();
+  bool isCounter = pythia[MBIAS]->rndm.isCounterBased();
+  vector<int> seeds;
+  if ( !isCounter ) {
+    seeds.resize(nColl + 1);
+    for ( int& seed : seeds ) seed = rndmPtr->newSeed();
+  }
+
+  // Each thread picks the next event until all are done. Thread 0 uses
+  // the MBIAS object itself, the others one worker copy each.
+  atomic<bool> badCode(false);
+  parallelFor(nColl, int(mbWorkers.size()) + 1, [&](int iThread, int i) {
+    Pythia& pyt = ( iThread == 0 ) ? *pythia[MBIAS]
+      : *mbWorkers[iThread - 1].pythiaPtr;
+    shared_ptr<ProcessSelectorHook> hook = ( iThread == 0 ) ? selectMB
+      : mbWorkers[iThread - 1].selectPtr;
+    Info& infoIn = ( iThread == 0 ) ? *info[MBIAS]
+      : *mbWorkers[iThread - 1].infoPtr;
+    if ( isCounter ) {
+      pyt.rndm.setState(mbState);
+      pyt.rndm.setNextEvent(mbState.eventNext + i);
+    } else pyt.rndm.init(seeds[i]);
+    double bp = ( bMode > 0 && collsIn[i] ) ? collsIn[i]->bp : -1.0;
+    HoldProcess hold(hook, 101, bp);
+    int itry = MAXTRY;
+    while ( --itry ) {
+      if ( !pyt.next() ) continue;
+      if ( pyt.info.code() != 101 ) badCode = true;
+      events[i] = mkEventInfo(pyt, infoIn, collsIn[i]);
+      break;
+    }
+  });
+  if ( isCounter ) {
+    pythia[MBIAS]->rndm.setState(mbState);
+    pythia[MBIAS]->rndm.setNextEvent(mbState.eventNext + nColl);
+  } else pythia[MBIAS]->rndm.init(seeds[nColl]);
+
+  if ( badCode ) {
+    loggerPtr->ERROR_MSG("MBIAS info code not equal to set procid",
+                        "contact the authors");
+    doAbort = true;
+  }
+  return events;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set up worker copies of the initialized MBIAS object, to generate
+// non-diffractive sub-collisions in parallel. Not done if there are user
+// hooks, which may not be safe to use from several threads.
+
+bool Angantyr::initWorkers(int nThreads) {
+
+  nThreads = threadCount(nThreads);
+  if ( nThreads < 2 ) return true;
+  if ( HIHooksPtr || hasMBHooks ) {
+    loggerPtr->WARNING_MSG("sub-collisions are generated sequentially",
+      "since user hooks are used");
+    return true;
+  }
+
+  bool print = flag("HeavyIon:showInit") && !flag("Print:quiet");
+  if ( print ) cout << " Angantyr Info: Initializing " << nThreads - 1
+                    << " copies of minimum bias processes." << endl;
+  for ( int i = 1; i < nThreads; ++i ) {
+    MBWorker worker;
+    worker.pythiaPtr = new Pythia(pythia[MBIAS]->settings,
+      pythia[MBIAS]->particleData, false);
+    worker.selectPtr = make_shared<ProcessSelectorHook>();
+    worker.infoPtr   = nullptr;
+    mbWorkers.push_back(worker);
+    shared_ptr<InfoGrabber> ihg = make_shared<InfoGrabber>();
+    worker.pythiaPtr->addUserHooksPtr(worker.selectPtr);
+    worker.pythiaPtr->addUserHooksPtr(ihg);
+    if ( !worker.pythiaPtr->init() ) return false;
+    mbWorkers.back().infoPtr = ihg->getInfo();
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Generate primary absorptive (non-diffractive) nucleon-nucleon
 // sub-collisions.
 
@@ -743,15 +872,6 @@ bool Angantyr::genAbs(SubCollisionSet& subCollsIn,
     if ( subColl.type != SubCollision::ABS ) continue;
     if (!subColl.proj->done() && !subColl.targ->done() ) {
       abscoll.push_back(&subColl);
-      if ( bMode > 0 ) {
-        EventInfo ie = getND(subColl);
-        if (ie.code != 101) {
-          loggerPtr->ERROR_MSG("ND code not equal to 101",
-                            "contact the authors");
-          doAbort = true;
-        }
-        ndeve.insert(ie);
-      }
       subColl.proj->select();
       subColl.targ->select();
     } else
@@ -763,16 +883,17 @@ bool Angantyr::genAbs(SubCollisionSet& subCollsIn,
   int Nabs = abscoll.size();
   int Nadd = abspart.size();
 
-  if ( bMode == 0 ) {
-    for ( int i = 0; i < Nabs + Nadd; ++i ) {
-      EventInfo ie = getND();
-      if (ie.code != 101) {
-        loggerPtr->ERROR_MSG("ND code not equal to 101",
-                            "contact the authors");
-        doAbort = true;
-      }
-      ndeve.insert(ie);
+  // Generate the non-diffractive events, for the primary sub-collisions
+  // or unconnected to sub-collisions.
+  vector<const SubCollision*> ndcoll = abscoll;
+  if ( bMode == 0 ) ndcoll.assign(Nabs + Nadd, nullptr);
+  for ( const EventInfo& ie : getNDs(ndcoll) ) {
+    if (ie.code != 101) {
+      loggerPtr->ERROR_MSG("ND code not equal to 101",
+                          "contact the authors");
+      doAbort = true;
     }
+    ndeve.insert(ie);
   }
   vector<int> Nii(4, 0);
   vector<double> w(4, 0.0);
@@ -839,9 +960,7 @@ bool Angantyr::genAbs(SubCollisionSet& subCollsIn,
 void Angantyr::addSASD(const SubCollisionSet& subCollsIn) {
   // Collect absorptively wounded nucleons in secondary
   // sub-collisions.
-  int ntry = mode("Angantyr:SDTries");
-  if ( settingsPtr->isMode("HI:SDTries") )
-    ntry = mode("HI:SDTries");
+  int ntry = sdTriesPtr->valNow;
   for (const SubCollision& subColl : subCollsIn)
     if ( subColl.type == SubCollision::ABS ) {
       if ( subColl.targ->done() && !subColl.proj->done() ) {
@@ -918,8 +1037,7 @@ bool Angantyr::addSD(const SubCollisionSet& subCollsIn,
 
 void Angantyr::addSDsecond(const SubCollisionSet& subCollsIn) {
   // Collect secondary single diffractive sub-collisions.
-  int ntry = mode("Angantyr:SDTries");
-  if ( settingsPtr->isMode("HI:SDTries") )  ntry = mode("HI:SDTries");
+  int ntry = sdTriesPtr->valNow;
   for (const SubCollision& subColl : subCollsIn) {
     if ( !subColl.proj->done() &&
          ( subColl.type == SubCollision::SDEP ||
@@ -1579,7 +1697,7 @@ bool Angantyr::addNucleusRemnants() {
     if (nucleon.event())
       hiInfo.addProjectileNucleon(nucleon);
     else {
-      double e = pythia[HADRON]->parm("Beams:eA");
+      double e = eAPtr->valNow;
       double m = pythia[HADRON]->particleData.m0(nucleon.id());
       double pz = sqrt(max(e*e - m*m, 0.0));
       if ( nucleon.id() == 2212 ) {
@@ -1599,7 +1717,7 @@ bool Angantyr::addNucleusRemnants() {
     if (nucleon.event())
       hiInfo.addTargetNucleon(nucleon);
     else {
-      double e = pythia[HADRON]->parm("Beams:eB");
+      double e = eBPtr->valNow;
       double m = pythia[HADRON]->particleData.m0(nucleon.id());
       double pz = -sqrt(max(e*e - m*m, 0.0));
       if ( nucleon.id() == 2212 ) {
@@ -1671,6 +1789,8 @@ bool Angantyr::setKinematics(){
 
 bool Angantyr::setKinematics(double eCMIn) {
   pythia[MBIAS]->setKinematics(eCMIn);
+  for (MBWorker& worker : mbWorkers)
+    worker.pythiaPtr->setKinematics(eCMIn);
   if (!glauberOnly)
     pythia[SASD]->setKinematics(eCMIn);
   return setKinematics();
@@ -1678,6 +1798,8 @@ bool Angantyr::setKinematics(double eCMIn) {
 
 bool Angantyr::setKinematics(double eAIn, double eBIn) {
   pythia[MBIAS]->setKinematics(eAIn, eBIn);
+  for (MBWorker& worker : mbWorkers)
+    worker.pythiaPtr->setKinematics(eAIn, eBIn);
   if (!glauberOnly)
     pythia[SASD]->setKinematics(eAIn, eBIn);
   return setKinematics();
@@ -1686,6 +1808,8 @@ bool Angantyr::setKinematics(double eAIn, double eBIn) {
 bool Angantyr::setKinematics(double pxAIn, double pyAIn, double pzAIn,
   double pxBIn, double pyBIn, double pzBIn) {
   pythia[MBIAS]->setKinematics(pxAIn, pyAIn, pzAIn, pxBIn, pyBIn, pzBIn);
+  for (MBWorker& worker : mbWorkers)
+    worker.pythiaPtr->setKinematics(pxAIn, pyAIn, pzAIn, pxBIn, pyBIn, pzBIn);
   if (!glauberOnly)
     pythia[SASD]->setKinematics(pxAIn, pyAIn, pzAIn, pxBIn, pyBIn, pzBIn);
   return setKinematics();
@@ -1693,6 +1817,8 @@ bool Angantyr::setKinematics(double pxAIn, double pyAIn, double pzAIn,
 
 bool Angantyr::setKinematics(Vec4 pAIn, Vec4 pBIn) {
   pythia[MBIAS]->setKinematics(pAIn, pBIn);
+  for (MBWorker& worker : mbWorkers)
+    worker.pythiaPtr->setKinematics(pAIn, pBIn);
   if (!glauberOnly)
     pythia[SASD]->setKinematics(pAIn, pBIn);
   return setKinematics();
@@ -1700,6 +1826,19 @@ bool Angantyr::setKinematics(Vec4 pAIn, Vec4 pBIn) {
 
 //--------------------------------------------------------------------------
 
+// Print statistics. Errors in the worker copies are first moved over
+// to the MBIAS object, so that they are listed together with its own.
+
+void Angantyr::stat() {
+  for ( MBWorker& worker : mbWorkers ) {
+    pythia[MBIAS]->logger.errorCombine(worker.pythiaPtr->logger);
+    worker.pythiaPtr->logger.errorReset();
+  }
+  HeavyIons::stat();
+}
+
+//--------------------------------------------------------------------------
+
 // Make sure the correct information is available irrespective of frame type.
 
 void Angantyr::unifyFrames() {
@@ -1817,7 +1956,7 @@ bool Angantyr::next() {
       }
     }
 
-    if ( settingsPtr->flag("Beams:allowVertexSpread") ) {
+    if ( allowVertexSpreadPtr->valNow ) {
       pythia[HADRON]->getBeamShapePtr()->pick();
       Vec4 vertex = pythia[HADRON]->getBeamShapePtr()->vertex();
       for ( Particle & p : pythia[HADRON]->event ) p.vProdAdd( vertex);
@@ -5,7 +5,7 @@
 
 // This file is written by Stefan Prestel.
 // Function definitions (not found in the header) for the
-// Clustering and History classes.
+// Clustering, HistoryState, HistoryStates and History classes.
 
 #include "Pythia8/History.h"
 #include "Pythia8/SharedPointers.h"
@@ -34,6 +34,114 @@ void Clustering::list() const {
 
 //==========================================================================
 
+// The HistoryState and HistoryStates classes.
+
+//--------------------------------------------------------------------------
+
+// Store the clusterings of the state. The input vector is swapped in, so
+// as to avoid copying the Clustering objects.
+
+void HistoryState::setClusterings(vector<Clustering>& clusteringsIn) {
+
+  clusterings.swap(clusteringsIn);
+  int nClus = clusterings.size();
+  hasProbs.assign(nClus, false);
+  probs.assign(nClus, 0.);
+  next.assign(nClus, nullptr);
+  iReclustered.assign(nClus, 0);
+  hasClusterings = true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Find a state in the table, or add it if not found. The states are kept
+// in a deque, so that references to them stay valid when adding more.
+
+HistoryState& HistoryStates::find(const Event& event) {
+
+  vector<HistoryState*>& candidates = indexSave[hash(event)];
+  for (HistoryState* candidate : candidates)
+    if (equal(candidate->state, event)) return *candidate;
+  statesSave.push_back(HistoryState(event));
+  candidates.push_back(&statesSave.back());
+  return statesSave.back();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Hash of an event, from the flavours, colours and momenta of the particles.
+
+size_t HistoryStates::hash(const Event& event) {
+
+  std::hash<double> hashDouble;
+  size_t result = event.size();
+  auto combine = [&result](size_t value) {
+    result ^= value + 0x9e3779b97f4a7c15ULL + (result << 6) + (result >> 2);
+  };
+  for (int i = 0; i < event.size(); ++i) {
+    const Particle& pNow = event[i];
+    combine( size_t(pNow.id()) );
+    combine( size_t(pNow.status()) );
+    combine( size_t(pNow.col()) );
+    combine( size_t(pNow.acol()) );
+    combine( hashDouble(pNow.px()) );
+    combine( hashDouble(pNow.py()) );
+    combine( hashDouble(pNow.pz()) );
+    combine( hashDouble(pNow.e()) );
+  }
+  return result;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Two events are only considered equal if all stored information agrees,
+// since any of it may be used in the further clustering.
+
+bool HistoryStates::equal(const Event& event1, const Event& event2) {
+
+  // Compare event properties.
+  if ( event1.size() != event2.size()
+    || event1.sizeJunction() != event2.sizeJunction()
+    || event1.scale() != event2.scale()
+    || event1.scaleSecond() != event2.scaleSecond()
+    || event1.lastColTag() != event2.lastColTag() ) return false;
+
+  // Compare the particles.
+  for (int i = 0; i < event1.size(); ++i) {
+    const Particle& p1 = event1[i];
+    const Particle& p2 = event2[i];
+    if ( p1.id() != p2.id() || p1.status() != p2.status()
+      || p1.mother1() != p2.mother1() || p1.mother2() != p2.mother2()
+      || p1.daughter1() != p2.daughter1() || p1.daughter2() != p2.daughter2()
+      || p1.col() != p2.col() || p1.acol() != p2.acol()
+      || p1.px() != p2.px() || p1.py() != p2.py() || p1.pz() != p2.pz()
+      || p1.e() != p2.e() || p1.m() != p2.m() || p1.scale() != p2.scale()
+      || p1.pol() != p2.pol() || p1.xProd() != p2.xProd()
+      || p1.yProd() != p2.yProd() || p1.zProd() != p2.zProd()
+      || p1.tProd() != p2.tProd() || p1.tau() != p2.tau() ) return false;
+  }
+
+  // Compare the junctions.
+  for (int i = 0; i < event1.sizeJunction(); ++i) {
+    const Junction& j1 = event1.getJunction(i);
+    const Junction& j2 = event2.getJunction(i);
+    if ( j1.remains() != j2.remains() || j1.kind() != j2.kind() )
+      return false;
+    for (int j = 0; j < 3; ++j)
+      if ( j1.col(j) != j2.col(j) || j1.endCol(j) != j2.endCol(j)
+        || j1.status(j) != j2.status(j) ) return false;
+  }
+
+  // Done.
+  return true;
+
+}
+
+//==========================================================================
+
 // The History class.
 
 // A History object represents an event in a given step in the CKKW-L
@@ -102,6 +210,7 @@ History::History( int depthIn,
       iReclusteredOld(0),
       iReclusteredNew(),
       doInclude(true),
+      statesPtr(nullptr),
       mergingHooksPtr(mergingHooksPtrIn),
       beamA(beamAIn),
       beamB(beamBIn),
@@ -118,6 +227,12 @@ History::History( int depthIn,
   // Initialise beam particles
   setupBeams();
 
+  // Find the state in the table of distinct states, which is created by
+  // the initial node and shared by all nodes during the construction.
+  HistoryStates statesInitial;
+  statesPtr = (mother) ? mother->statesPtr : &statesInitial;
+  HistoryState& stateNow = statesPtr->find(state);
+
   // Update probability with PDF ratio
   if (mother && mergingHooksPtr->includeRedundant()) prob *= pdfForSudakov();
 
@@ -154,37 +269,59 @@ History::History( int depthIn,
   bool qcd = ( nFinalP > mergingHooksPtr->hardProcess->nQuarksOut() );
 
   // If this is not the fully clustered state, try to find possible
-  // QCD clusterings.
-  vector<Clustering> clusterings;
-  if ( qcd && depth > 0 ) clusterings = getAllQCDClusterings();
-
-  bool dow = ( mergingHooksPtr->doWeakClustering()
-    && nFinalP > 1 && nFinalW+nFinalZ > 0 );
-
-  // If necessary, try to find possible EW clusterings.
-  vector<Clustering> clusteringsEW;
-  if ( depth > 0 && dow )
-    clusteringsEW = getAllEWClusterings();
-  if ( !clusteringsEW.empty() ) {
-    clusterings.insert( clusterings.end(), clusteringsEW.begin(),
-                        clusteringsEW.end() );
-  }
-
-  // If necessary, try to find possible SQCD clusterings.
-  vector<Clustering> clusteringsSQCD;
-  if ( depth > 0 && mergingHooksPtr->doSQCDClustering() )
-    clusteringsSQCD = getAllSQCDClusterings();
-  if ( !clusteringsSQCD.empty() )
-    clusterings.insert( clusterings.end(), clusteringsSQCD.begin(),
-                        clusteringsSQCD.end() );
+  // QCD clusterings, unless already done for an identical state.
+  if ( depth > 0 && !stateNow.hasClusterings ) {
+    vector<Clustering> clusteringsNow;
+    if ( qcd ) clusteringsNow = getAllQCDClusterings();
+
+    bool dow = ( mergingHooksPtr->doWeakClustering()
+      && nFinalP > 1 && nFinalW+nFinalZ > 0 );
+
+    // If necessary, try to find possible EW clusterings.
+    vector<Clustering> clusteringsEW;
+    if ( dow )
+      clusteringsEW = getAllEWClusterings();
+    if ( !clusteringsEW.empty() ) {
+      clusteringsNow.insert( clusteringsNow.end(), clusteringsEW.begin(),
+                          clusteringsEW.end() );
+    }
+
+    // If necessary, try to find possible SQCD clusterings.
+    vector<Clustering> clusteringsSQCD;
+    if ( mergingHooksPtr->doSQCDClustering() )
+      clusteringsSQCD = getAllSQCDClusterings();
+    if ( !clusteringsSQCD.empty() )
+      clusteringsNow.insert( clusteringsNow.end(), clusteringsSQCD.begin(),
+                          clusteringsSQCD.end() );
+    stateNow.setClusterings(clusteringsNow);
+
+    // The QCD clusterings may have been found for a state with shuffled
+    // colours, which then replaces the current one.
+    if ( mergingHooksPtr->allowColourShuffling() ) {
+      stateNow.shuffledState    = state;
+      stateNow.hasShuffledState = true;
+    }
+
+  // For an identical state use the same colours as when the clusterings
+  // were found, since the clusterings and later weights refer to these.
+  } else if ( depth > 0 && stateNow.hasShuffledState )
+    state = stateNow.shuffledState;
+  vector<Clustering> noClusterings;
+  vector<Clustering>& clusterings = (depth > 0) ? stateNow.clusterings
+    : noClusterings;
 
   // If no clusterings were found, the recursion is done and we
   // register this node.
   if ( clusterings.empty() ) {
     // Multiply with hard process matrix element.
-    prob *= hardProcessME(state);
+    if (!stateNow.hasHardME) {
+      stateNow.hardME    = hardProcessME(state);
+      stateNow.hasHardME = true;
+    }
+    prob *= stateNow.hardME;
     if (registerPath( *this, isOrdered, isStronglyOrdered, isAllowed,
       depth == 0 )) updateMinDepth(depth);
+    statesPtr = nullptr;
     return;
   }
 
@@ -254,17 +391,18 @@ History::History( int depthIn,
     }
 
     // Check if reclustered state should be disallowed.
+    int iClus = it->second - &clusterings[0];
     bool doCut = mergingHooksPtr->canCutOnRecState()
               || mergingHooksPtr->allowCutOnRecState();
     bool allowed = isAllowed;
     if (  doCut
-      && mergingHooksPtr->doCutOnRecState(cluster(*it->second)) ) {
+      && mergingHooksPtr->doCutOnRecState(cluster(stateNow, iClus)) ) {
       if ( onlyAllowedPaths()  ) continue;
       allowed = false;
     }
 
     // Skip if this branch is already strongly suppressed.
-    double p = getProb(*it->second);
+    double p = getProb(stateNow, iClus);
     if (abs(p)*prob < 1e-10*probMax()) continue;
     updateProbMax(abs(p)*prob,depth==0);
 
@@ -272,7 +410,7 @@ History::History( int depthIn,
     if (p==0.) continue;
 
     // Create new state - already here, to catch errors when clustering.
-    Event newState(cluster(*it->second));
+    const Event& newState = cluster(stateNow, iClus);
     if (newState.size()<3) continue;
 
     // Perform the clustering and recurse and construct the next
@@ -283,6 +421,9 @@ History::History( int depthIn,
            true, prob*p, this ));
   }
 
+  // The table of distinct states is no longer needed.
+  statesPtr = nullptr;
+
 }
 
 //--------------------------------------------------------------------------
@@ -3276,8 +3417,9 @@ double History::hardRenScale(const Event& event) {
 vector<double> History::doTrialShower( PartonLevel* trial, int type,
   double maxscaleIn, double minscaleIn ) {
 
-  // Copy state to local process
-  Event process        = state;
+  // Copy state to local process, reusing the trial shower event records.
+  Event& process       = mergingHooksPtr->trialProcess;
+  process              = state;
   // Set starting scale.
   double startingScale = maxscaleIn;
   // Careful when setting shower starting scale for pure QCD and prompt
@@ -3314,8 +3456,7 @@ vector<double> History::doTrialShower( PartonLevel* trial, int type,
              ->weightsSimpleShower.weightValues)
         showerwt = 1.;
     // Construct event to be showered
-    Event event = Event();
-    event.init("(hard process-modified)", particleDataPtr);
+    Event& event = mergingHooksPtr->trialEvent;
     event.clear();
 
     // Reset process scale so that shower starting scale is correctly set.
@@ -3495,8 +3636,9 @@ vector<double> History::countEmissions(PartonLevel* trial, double maxscale,
   result[0] = 1.0;
   if ( N < 1 ) return result;
 
-  // Copy state to local process
-  Event process = state;
+  // Copy state to local process, reusing the trial shower event records.
+  Event& process = mergingHooksPtr->trialProcess;
+  process        = state;
 
   double startingScale   = maxscale;
   // Careful when setting shower starting scale for pure QCD and prompt
@@ -3521,8 +3663,7 @@ vector<double> History::countEmissions(PartonLevel* trial, double maxscale,
     for (double &wt: infoPtr->weightContainerPtr
            ->weightsSimpleShower.weightValues) wt = 1.;
     // Construct event to be showered
-    Event event = Event();
-    event.init("(hard process-modified)", particleDataPtr);
+    Event& event = mergingHooksPtr->trialEvent;
     event.clear();
 
     // Reset process scale
@@ -6130,6 +6271,11 @@ double History::hardProcessME( const Event& event ) {
 
 Event History::cluster( Clustering & inSystem ) {
 
+  // No reclustered radiator is known unless set below. The value is stored
+  // along with the clustered state, so must not be left from an earlier
+  // clustering.
+  iReclusteredNew = 0;
+
   // Initialise tags of particles to be changed
   int Rad = inSystem.emittor;
   int Rec = inSystem.recoiler;
@@ -6759,6 +6905,39 @@ Event History::cluster( Clustering & inSystem ) {
 
 //--------------------------------------------------------------------------
 
+// Probability of the clustering of index iClus of the current state.
+// Only calculated once for each distinct state.
+
+double History::getProb(HistoryState& stateNow, int iClus) {
+
+  if (!stateNow.hasProbs[iClus]) {
+    stateNow.probs[iClus]    = getProb(stateNow.clusterings[iClus]);
+    stateNow.hasProbs[iClus] = true;
+  }
+  return stateNow.probs[iClus];
+
+}
+
+//--------------------------------------------------------------------------
+
+// Clustered state for the clustering of index iClus of the current state.
+// Only constructed once for each distinct state, and then looked up in
+// the table of distinct states, along with the reclustered radiator.
+
+const Event& History::cluster(HistoryState& stateNow, int iClus) {
+
+  if (!stateNow.next[iClus]) {
+    Event newState = cluster(stateNow.clusterings[iClus]);
+    stateNow.iReclustered[iClus] = iReclusteredNew;
+    stateNow.next[iClus] = &statesPtr->find(newState);
+  }
+  iReclusteredNew = stateNow.iReclustered[iClus];
+  return stateNow.next[iClus]->state;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Function to get the flavour of the radiator before the splitting
 // for clustering
 // IN int  : Flavour of the radiator after the splitting
@@ -8,6 +8,8 @@
 // Function definitions.
 
 #include "Pythia8/LHEF3.h"
+#include <cstdint>
+#include <cstring>
 
 namespace Pythia8 {
 
@@ -511,13 +513,209 @@ void HEPEUP::resize() {
   ISTUP.resize(NUP);
   MOTHUP.resize(NUP);
   ICOLUP.resize(NUP);
-  PUP.resize(NUP, vector<double>(5));
+  // Avoid creating the default momentum vector if the size is unchanged.
+  if (int(PUP.size()) != NUP) PUP.resize(NUP, vector<double>(5));
   VTIMUP.resize(NUP);
   SPINUP.resize(NUP);
 }
 
 //==========================================================================
 
+// Anonymous helper functions for the parsing of events by the Reader.
+
+namespace {
+
+// Powers of ten that are exactly represented as doubles.
+const double POW10[23] = { 1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8,
+  1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+  1e21, 1e22 };
+
+// White space that ends a number, as for stream extraction.
+inline bool isBlank(char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\v'
+    || c == '\f';}
+
+inline bool isDigit(char c) {return c >= '0' && c <= '9';}
+
+//--------------------------------------------------------------------------
+
+// Read an integer with at most nDigMax digits, skipping white space.
+// It must be followed by white space or the end of the range.
+
+bool parseLong(const char*& pos, const char* end, long& n,
+  int nDigMax = 18) {
+  const char* p = pos;
+  while (p < end && isBlank(*p)) ++p;
+  bool neg = false;
+  if (p < end && (*p == '+' || *p == '-')) neg = (*p++ == '-');
+  const char* first = p;
+  long value = 0;
+  for ( ; p < end && isDigit(*p); ++p) {
+    if (p - first == nDigMax) return false;
+    value = 10 * value + (*p - '0');
+  }
+  if (p == first || (p < end && !isBlank(*p))) return false;
+  n = neg ? -value : value;
+  pos = p;
+  return true;
+}
+
+bool parseInt(const char*& pos, const char* end, int& n) {
+  long value;
+  if (!parseLong(pos, end, value, 9)) return false;
+  n = int(value);
+  return true;
+}
+
+//--------------------------------------------------------------------------
+
+// Read a number in decimal notation, skipping white space. It must be
+// followed by white space or the end of the range. Only numbers that
+// can be converted exactly are handled, i.e. where the mantissa is at
+// most 2^53 and the power of ten at most 22, which covers the usual
+// output of matrix-element generators. Then a single multiplication or
+// division gives the correctly rounded result, the same as for stream
+// extraction. Otherwise false is returned, and the caller should fall
+// back on the standard library.
+
+bool parseDouble(const char*& pos, const char* end, double& x) {
+  const char* p = pos;
+  while (p < end && isBlank(*p)) ++p;
+  bool neg = false;
+  if (p < end && (*p == '+' || *p == '-')) neg = (*p++ == '-');
+
+  // Collect the significant digits of the mantissa.
+  uint64_t mant = 0;
+  int nDig = 0, nSig = 0, exp10 = 0;
+  for ( ; p < end && isDigit(*p); ++p, ++nDig) {
+    if (mant == 0 && *p == '0') continue;
+    if (++nSig > 19) return false;
+    mant = 10 * mant + (*p - '0');
+  }
+  if (p < end && *p == '.') {
+    for (++p; p < end && isDigit(*p); ++p, ++nDig) {
+      --exp10;
+      if (mant == 0 && *p == '0') continue;
+      if (++nSig > 19) return false;
+      mant = 10 * mant + (*p - '0');
+    }
+  }
+  if (nDig == 0) return false;
+
+  // Exponent, if any.
+  if (p < end && (*p == 'e' || *p == 'E')) {
+    ++p;
+    bool negExp = false;
+    if (p < end && (*p == '+' || *p == '-')) negExp = (*p++ == '-');
+    if (p == end || !isDigit(*p)) return false;
+    int expIn = 0;
+    for ( ; p < end && isDigit(*p); ++p)
+      if (expIn < 1000) expIn = 10 * expIn + (*p - '0');
+    exp10 += negExp ? -expIn : expIn;
+  }
+  if (p < end && !isBlank(*p)) return false;
+
+  // Convert, if it can be done exactly.
+  if (mant == 0) x = 0.;
+  else if (mant > (uint64_t(1) << 53) || exp10 < -22 || exp10 > 22)
+    return false;
+  else x = (exp10 < 0) ? double(mant) / POW10[-exp10]
+         : double(mant) * POW10[exp10];
+  if (neg) x = -x;
+  pos = p;
+  return true;
+}
+
+//--------------------------------------------------------------------------
+
+// Match an opening tag without attributes, such as <rwgt> or <rwgt >,
+// with the surrounding white space removed.
+
+bool matchOpenTag(const char* b, const char* e, const char* tag) {
+  int nTag = strlen(tag);
+  if (e - b < nTag + 1 || strncmp(b, tag, nTag) != 0 || *(e - 1) != '>')
+    return false;
+  for (const char* p = b + nTag; p < e - 1; ++p)
+    if (*p != ' ' && *p != '\t') return false;
+  return true;
+}
+
+//--------------------------------------------------------------------------
+
+// Match a line of the form <weights> w1 w2 ... </weights>, with the
+// surrounding white space removed, and store its contents. If false
+// is returned for such a line, the weights may have been changed.
+
+bool matchWeights(const char* b, const char* e, LHAweights& weights) {
+  static const char OPENTAG[] = "<weights>", CLOSETAG[] = "</weights>";
+  const int NOPEN = 9, NCLOSE = 10;
+  if (e - b < NOPEN + NCLOSE || strncmp(b, OPENTAG, NOPEN) != 0
+    || strncmp(e - NCLOSE, CLOSETAG, NCLOSE) != 0) return false;
+  const char* p = b + NOPEN;
+  const char* pEnd = e - NCLOSE;
+  weights.weights.clear();
+  while (true) {
+    while (p < pEnd && isBlank(*p)) ++p;
+    if (p == pEnd) break;
+    double w;
+    if (!parseDouble(p, pEnd, w)) return false;
+    weights.weights.push_back(w);
+  }
+  if (weights.weights.empty()) weights.contents.clear();
+  else weights.contents.assign(b + NOPEN, pEnd);
+  return true;
+}
+
+//--------------------------------------------------------------------------
+
+// Match a line of the form <wgt id="..."> w </wgt>, with the surrounding
+// white space removed, and extract the id and the weight.
+
+bool matchWgt(const char* b, const char* e, const char*& idBeg,
+  const char*& idEnd, double& value) {
+  static const char OPENTAG[] = "<wgt", IDATTR[] = "id=\"",
+    CLOSETAG[] = "</wgt>";
+  const int NOPEN = 4, NID = 4, NCLOSE = 6;
+  if (e - b < NOPEN + NID + NCLOSE || strncmp(b, OPENTAG, NOPEN) != 0
+    || strncmp(e - NCLOSE, CLOSETAG, NCLOSE) != 0) return false;
+  const char* p = b + NOPEN;
+  const char* pEnd = e - NCLOSE;
+  if (*p != ' ' && *p != '\t') return false;
+  while (p < pEnd && (*p == ' ' || *p == '\t')) ++p;
+  if (pEnd - p < NID || strncmp(p, IDATTR, NID) != 0) return false;
+  idBeg = p += NID;
+  while (p < pEnd && *p != '"' && *p != '\\' && *p != '<' && *p != '>') ++p;
+  if (p == pEnd || *p != '"') return false;
+  idEnd = p++;
+  while (p < pEnd && (*p == ' ' || *p == '\t')) ++p;
+  if (p == pEnd || *p != '>') return false;
+  if (!parseDouble(++p, pEnd, value)) return false;
+  while (p < pEnd && isBlank(*p)) ++p;
+  return p == pEnd;
+}
+
+//--------------------------------------------------------------------------
+
+// Append the non-empty lines of a text, with surrounding white space
+// removed, to the event comments.
+
+void appendComments(const string& text, string& comments) {
+  istringstream f(text);
+  string l;
+  while (getline(f, l)) {
+     size_t p = l.find_first_not_of(" \t");
+     l.erase(0, p);
+     p = l.find_last_not_of(" \t");
+     if (string::npos != p) l.erase(p+1);
+     if (l.find_last_not_of("\n") != string::npos)
+       comments += l + "\n";
+  }
+}
+
+}
+
+//==========================================================================
+
 // The Reader class is initialized with a stream from which to read a
 // version 1/2 Les Houches Accord event file. In the constructor of
 // the Reader object the optional header information is read and then
@@ -706,6 +904,7 @@ bool Reader::init() {
 bool Reader::readEvent(HEPEUP * peup) {
 
   HEPEUP & eup = (peup? *peup: hepeup);
+  if (streamParsing) return readEventStream(eup);
   eup.clear();
   eup.heprup = &heprup;
   weights_detailed_vec.clear();
@@ -776,16 +975,276 @@ bool Reader::readEvent(HEPEUP * peup) {
     leftovers="";
 
   eventComments = "";
-  istringstream f(leftovers);
-  string l;
-  while (getline(f, l)) {
-     size_t p = l.find_first_not_of(" \t");
-     l.erase(0, p);
-     p = l.find_last_not_of(" \t");
-     if (string::npos != p) l.erase(p+1);
-     if (l.find_last_not_of("\n") != string::npos)
-       eventComments += l + "\n";
+  appendComments(leftovers, eventComments);
+  setEventTags(tags, eup);
+
+  for ( int i = 0, N = tags.size(); i < N; ++i ) if (tags[i]) delete tags[i];
+
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Streaming parsing of an event. Numbers are converted directly from
+// the line buffer, and the common rwgt and weights blocks are parsed
+// line by line, without creating XML tags. Anything not recognized is
+// handed over to the generic parsing, starting from the first line with
+// an unknown tag, so that the results are identical to it.
+
+bool Reader::readEventStream(HEPEUP & eup) {
+
+  // Reset the event, except for the detailed weights, whose storage
+  // may be reused. These are instead reset if the reading fails.
+  eup.NUP = 0;
+  eup.weights_compressed.clear();
+  eup.weightsSave.clear();
+  eup.scalesSave.clear();
+  eup.attributes.clear();
+  eup.heprup = &heprup;
+  auto fail = [&]() {
+    setDetailedWeights(eup, false);
+    return false;
+  };
+
+  // Check if the initialization was successful. Otherwise we will
+  // not read any events.
+  if ( heprup.NPRUP < 0 ) return fail();
+  eventComments.clear();
+  outsideBlock.clear();
+
+  // Keep reading lines until we hit the next event or the end of
+  // the event block. Save any inbetween lines.
+  while ( getLine() && currentLine.find("<event") == string::npos )
+    outsideBlock.append(currentLine).append(1, '\n');
+
+  // Get event attributes, if there are any.
+  if (currentLine != "") {
+    size_t b = currentLine.find_first_not_of(" \t");
+    size_t e = currentLine.find_last_not_of(" \t") + 1;
+    const char* linePtr = currentLine.c_str();
+    if (!matchOpenTag(linePtr + b, linePtr + e, "<event")) {
+      vector<XMLTag*> evtags = XMLTag::findXMLTags(currentLine + "</event>");
+      XMLTag & evtag = *evtags[0];
+      for ( map<string,string>::const_iterator it = evtag.attr.begin();
+            it != evtag.attr.end(); ++it )
+        eup.attributes.insert(make_pair(it->first,it->second));
+      for ( int i = 0, N = evtags.size(); i < N; ++i )
+        if (evtags[i]) delete evtags[i];
+    }
+  }
+
+  if ( !getLine() ) return fail();
+
+  // The first line determines how many subsequent particle lines we
+  // have. Use stream extraction for anything not handled by the fast
+  // conversion.
+  const char* pos = currentLine.c_str();
+  const char* end = pos + currentLine.size();
+  if ( !( parseInt(pos, end, eup.NUP) && parseInt(pos, end, eup.IDPRUP)
+    && parseDouble(pos, end, eup.XWGTUP) && parseDouble(pos, end, eup.SCALUP)
+    && parseDouble(pos, end, eup.AQEDUP)
+    && parseDouble(pos, end, eup.AQCDUP) ) ) {
+    istringstream iss(currentLine);
+    if ( !( iss >> eup.NUP >> eup.IDPRUP >> eup.XWGTUP
+                >> eup.SCALUP >> eup.AQEDUP >> eup.AQCDUP ) )
+      return fail();
+  }
+  eup.resize();
+
+  // Read all particle lines.
+  for ( int i = 0; i < eup.NUP; ++i ) {
+    if ( !getLine() ) return fail();
+    pos = currentLine.c_str();
+    end = pos + currentLine.size();
+    vector<double> & pup = eup.PUP[i];
+    if ( parseLong(pos, end, eup.IDUP[i]) && parseInt(pos, end, eup.ISTUP[i])
+      && parseInt(pos, end, eup.MOTHUP[i].first)
+      && parseInt(pos, end, eup.MOTHUP[i].second)
+      && parseInt(pos, end, eup.ICOLUP[i].first)
+      && parseInt(pos, end, eup.ICOLUP[i].second)
+      && parseDouble(pos, end, pup[0]) && parseDouble(pos, end, pup[1])
+      && parseDouble(pos, end, pup[2]) && parseDouble(pos, end, pup[3])
+      && parseDouble(pos, end, pup[4]) && parseDouble(pos, end, eup.VTIMUP[i])
+      && parseDouble(pos, end, eup.SPINUP[i]) ) continue;
+    istringstream isss(currentLine);
+    if ( !( isss >> eup.IDUP[i] >> eup.ISTUP[i]
+                >> eup.MOTHUP[i].first >> eup.MOTHUP[i].second
+                >> eup.ICOLUP[i].first >> eup.ICOLUP[i].second
+                >> pup[0] >> pup[1] >> pup[2] >> pup[3] >> pup[4]
+                >> eup.VTIMUP[i] >> eup.SPINUP[i] ) )
+      return fail();
+  }
+
+  // Now read any additional comments.
+  while ( getLine() && currentLine.find("</event>") == string::npos )
+    eventComments.append(currentLine).append(1, '\n');
+
+  if ( file == nullptr ) return fail();
+
+  eup.scalesSave = LHAscales(eup.SCALUP);
+
+  // Scan the comments line by line. Lines without tags are kept as
+  // comments, while the rwgt and weights blocks are parsed directly.
+  const string & str = eventComments;
+  const char* strPtr = str.c_str();
+  commentsSave.clear();
+  nWgtSave = 0;
+  bool foundRwgt = false;
+  size_t lineBeg = 0, residual = string::npos;
+  while (lineBeg < str.size()) {
+    size_t lineEnd = str.find('\n', lineBeg);
+    size_t b = str.find_first_not_of(" \t", lineBeg);
+    if (b >= lineEnd) {
+      lineBeg = lineEnd + 1;
+      continue;
+    }
+    size_t e = str.find_last_not_of(" \t", lineEnd - 1) + 1;
+
+    // A line without tags.
+    if (memchr(strPtr + b, '<', e - b) == nullptr) {
+      commentsSave.append(str, b, e - b).append(1, '\n');
+      lineBeg = lineEnd + 1;
+      continue;
+    }
+
+    // A weights block on a single line.
+    if (matchWeights(strPtr + b, strPtr + e, eup.weightsSave)) {
+      eup.weights_compressed.insert(eup.weights_compressed.end(),
+        eup.weightsSave.weights.begin(), eup.weightsSave.weights.end());
+      lineBeg = lineEnd + 1;
+      continue;
+    }
+
+    // A rwgt block with one wgt tag per line. Only the first such block
+    // is handled here, to keep the order of the detailed weights. The
+    // text between the tags, which may include lines without tags, gives
+    // the contents of the block, as in the generic parsing.
+    if (!foundRwgt && matchOpenTag(strPtr + b, strPtr + e, "<rwgt")) {
+      size_t next = lineEnd + 1;
+      size_t textBeg = e;
+      bool closed = false;
+      rwgtContentsSave.clear();
+      while (next < str.size()) {
+        size_t wgtEnd = str.find('\n', next);
+        size_t wb = str.find_first_not_of(" \t", next);
+        next = wgtEnd + 1;
+        if (wb >= wgtEnd) continue;
+        size_t we = str.find_last_not_of(" \t", wgtEnd - 1) + 1;
+        if (str.compare(wb, we - wb, "</rwgt>") == 0) {
+          rwgtContentsSave.append(str, textBeg, wb - textBeg);
+          closed = true;
+          break;
+        }
+        if (memchr(strPtr + wb, '<', we - wb) == nullptr
+          && memchr(strPtr + wb, '>', we - wb) == nullptr) continue;
+        const char *idBeg, *idEnd;
+        double value;
+        if (!matchWgt(strPtr + wb, strPtr + we, idBeg, idEnd, value)) break;
+        rwgtContentsSave.append(str, textBeg, wb - textBeg);
+        textBeg = we;
+        if (nWgtSave == int(wgtIdsSave.size())) {
+          wgtIdsSave.push_back("");
+          wgtValuesSave.push_back(0.);
+        }
+        wgtIdsSave[nWgtSave].assign(idBeg, idEnd);
+        wgtValuesSave[nWgtSave++] = value;
+      }
+      if (closed) {
+        if (rwgtContentsSave.find_first_not_of(" \t\n") == string::npos)
+          rwgtContentsSave.clear();
+        foundRwgt = true;
+        lineBeg = next;
+        continue;
+      }
+      nWgtSave = 0;
+    }
+
+    // Anything else is left to the generic parsing.
+    residual = lineBeg;
+    break;
+  }
+  setDetailedWeights(eup, foundRwgt);
+
+  // Generic parsing of the remaining lines.
+  if (residual != string::npos) {
+    string leftovers;
+    vector<XMLTag*> tags = XMLTag::findXMLTags(str.substr(residual),
+      &leftovers);
+    appendComments(leftovers, commentsSave);
+    setEventTags(tags, eup);
+    for ( int i = 0, N = tags.size(); i < N; ++i ) if (tags[i]) delete tags[i];
   }
+  eventComments.swap(commentsSave);
+
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Store the wgt tags found by the streaming parsing in the event. If
+// the ids are the same as in the previous event, only the values are
+// updated, so that no memory needs to be allocated.
+
+void Reader::setDetailedWeights(HEPEUP & eup, bool found) {
+
+  // No rwgt block: same reset as in HEPEUP::clear().
+  LHArwgt & rwgt = eup.rwgtSave;
+  if (!found) {
+    rwgt.clear();
+    eup.weights_detailed.clear();
+    weights_detailed_vec.clear();
+    weightnames_detailed_vec.clear();
+    return;
+  }
+
+  // Try to update the values in place.
+  bool reuse = rwgt.attributes.empty()
+    && int(rwgt.wgtsKeys.size()) == nWgtSave
+    && int(rwgt.wgts.size()) == nWgtSave
+    && int(eup.weights_detailed.size()) == nWgtSave;
+  for (int i = 0; reuse && i < nWgtSave; ++i) {
+    map<string,LHAwgt>::iterator wgtItr = rwgt.wgts.find(wgtIdsSave[i]);
+    map<string,double>::iterator detItr
+      = eup.weights_detailed.find(wgtIdsSave[i]);
+    if (rwgt.wgtsKeys[i] != wgtIdsSave[i] || wgtItr == rwgt.wgts.end()
+      || detItr == eup.weights_detailed.end()
+      || !wgtItr->second.attributes.empty()) reuse = false;
+    else wgtItr->second.contents = detItr->second = wgtValuesSave[i];
+  }
+
+  // Else build the maps from scratch.
+  if (!reuse) {
+    rwgt.clear();
+    rwgt.wgtsKeys.clear();
+    eup.weights_detailed.clear();
+    for (int i = 0; i < nWgtSave; ++i) {
+      LHAwgt wt(wgtValuesSave[i]);
+      wt.id = wgtIdsSave[i];
+      rwgt.wgts.insert(make_pair(wt.id, wt));
+      rwgt.wgtsKeys.push_back(wt.id);
+      eup.weights_detailed.insert(make_pair(wt.id, wt.contents));
+    }
+  }
+  rwgt.contents = rwgtContentsSave;
+
+  // The linearized weights, where the names are usually unchanged.
+  weights_detailed_vec.assign(wgtValuesSave.begin(),
+    wgtValuesSave.begin() + nWgtSave);
+  if (int(weightnames_detailed_vec.size()) != nWgtSave
+    || !equal(weightnames_detailed_vec.begin(),
+      weightnames_detailed_vec.end(), wgtIdsSave.begin()))
+    weightnames_detailed_vec.assign(wgtIdsSave.begin(),
+      wgtIdsSave.begin() + nWgtSave);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Store the information of the XML tags found among the event comments.
+
+void Reader::setEventTags(const vector<XMLTag*> & tags, HEPEUP & eup) {
 
   for ( int i = 0, N = tags.size(); i < N; ++i ) {
     XMLTag & tag = *tags[i];
@@ -828,10 +1287,6 @@ bool Reader::readEvent(HEPEUP * peup) {
     }
   }
 
-  for ( int i = 0, N = tags.size(); i < N; ++i ) if (tags[i]) delete tags[i];
-
-  return true;
-
 }
 
 //==========================================================================
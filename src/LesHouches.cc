@@ -3,8 +3,8 @@
 // PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
 // Please respect the MCnet Guidelines, see GUIDELINES for details.
 
-// Function definitions (not found in the header) for the LHAup and
-// LHAupLHEF classes.
+// Function definitions (not found in the header) for the LHAup,
+// LHEFDispatcher and LHAupLHEF classes.
 
 #include "Pythia8/Pythia.h"
 #include "Pythia8/LesHouches.h"
@@ -668,6 +668,127 @@ void LHAup::closeFile(istream *&is, ifstream &ifs) {
 
 //==========================================================================
 
+// LHEFDispatcher class.
+
+//--------------------------------------------------------------------------
+
+// Read the header and init blocks, and start the reader thread.
+
+bool LHEFDispatcher::init() {
+
+  // Store the text up to the end of the init block, for the LHAupLHEF
+  // objects to parse on their own.
+  igzstream isText(fileName.c_str());
+  if (!isText.good()) return false;
+  string line;
+  initBlockSave = "";
+  while (getline(isText, line)) {
+    initBlockSave += line + "\n";
+    if (line.find("</init>") != string::npos) break;
+  }
+  isText.close();
+
+  // Open the file for the events.
+  readerPtr = unique_ptr<Reader>(new Reader(fileName));
+  if (!readerPtr->isGood) return false;
+
+  // Optionally skip ahead a number of events.
+  for (int iSkip = 0; iSkip < nSkip; ++iSkip)
+    if (!readerPtr->readEvent()) break;
+
+  // Start reading events in the background.
+  readerThread = thread(&LHEFDispatcher::readEvents, this);
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Stop the reader thread.
+
+void LHEFDispatcher::stop() {
+
+  {
+    lock_guard<mutex> lock(queueMutex);
+    doStop = true;
+  }
+  notFull.notify_all();
+  notEmpty.notify_all();
+  if (readerThread.joinable()) readerThread.join();
+
+}
+
+//--------------------------------------------------------------------------
+
+// Copy the next event into a Reader.
+
+bool LHEFDispatcher::nextEvent(Reader& reader) {
+
+  // Wait for an event, or for the end of the file.
+  unique_ptr<EventRecord> recordPtr;
+  {
+    unique_lock<mutex> lock(queueMutex);
+    notEmpty.wait(lock, [this]() {
+      return !eventQueue.empty() || atEnd || doStop; });
+    if (eventQueue.empty()) return false;
+    recordPtr = std::move(eventQueue.front());
+    eventQueue.pop_front();
+  }
+  notFull.notify_one();
+
+  // Store the event as if read by the Reader itself.
+  reader.hepeup = recordPtr->hepeup;
+  reader.hepeup.heprup = &reader.heprup;
+  reader.eventComments.swap(recordPtr->eventComments);
+  reader.weights_detailed_vec.swap(recordPtr->weightsDetailed);
+  reader.weightnames_detailed_vec.swap(recordPtr->weightNamesDetailed);
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Main loop of the reader thread: read events and queue them up, waiting
+// while the queue is full.
+
+void LHEFDispatcher::readEvents() {
+
+  while (true) {
+
+    // Read the next event outside the lock.
+    unique_ptr<EventRecord> recordPtr(new EventRecord());
+    bool gotEvent = readerPtr->readEvent(&recordPtr->hepeup);
+    if (gotEvent) {
+      recordPtr->eventComments.swap(readerPtr->eventComments);
+      recordPtr->weightsDetailed.swap(readerPtr->weights_detailed_vec);
+      recordPtr->weightNamesDetailed.swap(
+        readerPtr->weightnames_detailed_vec);
+    }
+
+    // Queue it up, or flag the end of the file.
+    {
+      unique_lock<mutex> lock(queueMutex);
+      if (!gotEvent) atEnd = true;
+      else {
+        notFull.wait(lock, [this]() {
+          return doStop || int(eventQueue.size()) < bufferSize; });
+        if (!doStop) {
+          eventQueue.push_back(std::move(recordPtr));
+          ++nReadSave;
+        }
+      }
+      if (atEnd || doStop) {
+        notEmpty.notify_all();
+        return;
+      }
+    }
+    notEmpty.notify_one();
+  }
+
+}
+
+//==========================================================================
+
 // LHAupLHEF class.
 
 //--------------------------------------------------------------------------
@@ -941,8 +1062,11 @@ bool LHAupLHEF::setInitLHEF( istream & isIn, bool readHead ) {
 
 bool LHAupLHEF::setNewEventLHEF() {
 
-  // Done if the reader finished preemptively.
-  if(!reader.readEvent()) return false;
+  // Done if the reader finished preemptively. With a dispatcher the
+  // event has instead been read in by it.
+  if (dispatcherPtr) {
+    if (!dispatcherPtr->nextEvent(reader)) return false;
+  } else if (!reader.readEvent()) return false;
 
   // Extract process info and store it.
   nupSave     = reader.hepeup.NUP;
@@ -2133,6 +2133,8 @@ void MergingHooks::init(){
 
   // Initialise input event.
   inputEvent.init("(hard process)", particleDataPtr);
+  trialProcess.init("(hard process)", particleDataPtr);
+  trialEvent.init("(hard process-modified)", particleDataPtr);
   doRemoveDecayProducts = doGuess || flag("Merging:mayRemoveDecayProducts");
   settingsPtr->flag("Merging:mayRemoveDecayProducts",doRemoveDecayProducts);
 
@@ -552,6 +552,34 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
   initFile  = word("MultipartonInteractions:initFile");
   int idBsave = infoPtr->idB();
   bool reuseWorked = (reuseInit == 2 || reuseInit == 3) && loadMPIdata();
+
+  // Alternatively reuse data calculated by another Pythia instance with
+  // the same setup, when tables are shared between instances. The key
+  // includes a hash of the settings, since these may differ between
+  // instances, e.g. when changed in a PythiaParallel customInit.
+  bool shareInit = (infoPtr->sharedTablesPtr != nullptr);
+  ostringstream shareKey;
+  if (shareInit) {
+    static const vector<string> skipKeys = { "main:", "next:", "random:",
+      "print:", "init:", "stat:", "check:", "parallelism:",
+      "phasespace:reuseinit", "phasespace:initfile",
+      "multipartoninteractions:reuseinit",
+      "multipartoninteractions:initfile" };
+    shareKey << "MultipartonInteractions:" << iDiffSys << ":"
+             << infoPtr->idA() << ":" << infoPtr->idB() << ":" << nPDFA << ":"
+             << scientific << setprecision(10) << infoPtr->eCM() << ":"
+             << setupKey(skipKeys);
+  }
+  if (!reuseWorked && shareInit) {
+    shared_ptr<const vector<MPIInterpolationInfo> > sharedPtr
+      = infoPtr->sharedTablesPtr->find<vector<MPIInterpolationInfo> >(
+      shareKey.str());
+    if (sharedPtr) {
+      mpis = *sharedPtr;
+      setMPIdata();
+      reuseWorked = true;
+    }
+  }
   if (!reuseWorked) {
     if (reuseInit == 2) {
       loggerPtr->ABORT_MSG("failed to load MPI data");
@@ -790,7 +818,7 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
       sigmaMaxViol = max( sigmaMaxViol, pT4dSigmaMax / pT4dSigmaMaxBeg);
 
       // Save values calculated.
-      if (nStep > 1 || reuseInit == 1 || reuseInit == 3) {
+      if (nStep > 1 || reuseInit == 1 || reuseInit == 3 || shareInit) {
         mpis[iPA].pT0Save[iStep]          = pT0;
         mpis[iPA].pT4dSigmaMaxSave[iStep] = pT4dSigmaMax;
         mpis[iPA].pT4dProbMaxSave[iStep]  = pT4dProbMax;
@@ -849,6 +877,10 @@ bool MultipartonInteractions::init( bool doMPIinit, int iDiffSysIn,
     else
       loggerPtr->ERROR_MSG("failed to write initialization data");
   }
+  if (shareInit && !reuseWorked && mpis[0].nStepSave > 0)
+    infoPtr->sharedTablesPtr->insert( shareKey.str(),
+      shared_ptr<const vector<MPIInterpolationInfo> >(
+      make_shared<vector<MPIInterpolationInfo> >(mpis)));
 
   // Restore to default setup with option 0. Does not apply for Pomeron beam.
   if (nPDFA != 1 && iDiffSys < 2) {
@@ -1794,7 +1826,19 @@ bool MultipartonInteractions::loadMPIdata() {
     }
   }
 
-  // Also store it in regular location at fixed or maximal (= eCMsave) energy.
+  // Close file and set current values from the data read.
+  is.close();
+  setMPIdata();
+  return true;
+}
+
+//--------------------------------------------------------------------------
+
+// Set current values from the stored initialization data, at fixed or
+// maximal (= eCMsave) energy.
+
+void MultipartonInteractions::setMPIdata() {
+
   iPDFAsave    = 0;
   eCMsave      = mpis[0].eStepMaxSave;
   nStep        = mpis[0].nStepSave;
@@ -1832,9 +1876,6 @@ bool MultipartonInteractions::loadMPIdata() {
   pT2maxmin    = pT2max - pT2min;
   normPi       = 1. / (2. * M_PI);
 
-  // Close file and done.
-  is.close();
-  return true;
 }
 
 //--------------------------------------------------------------------------
@@ -68,6 +68,20 @@ bool NucleonExcitations::init(string path) {
     return false;
   }
 
+  // Reuse tables read from the same file by another instance, if possible.
+  // The key includes the particle data as for the hadron widths, so that
+  // objects with different particle data share neither kind of table.
+  if (infoPtr->sharedTablesPtr) {
+    shared_ptr<const Tables> sharedPtr
+      = infoPtr->sharedTablesPtr->get<Tables>( "NucleonExcitations:"
+      + path + ":" + particleDataKey(), [&]() -> shared_ptr<const Tables> {
+        if (!init(stream)) return nullptr;
+        return tablesPtr.share(); });
+    if (!sharedPtr) return false;
+    tablesPtr.use(sharedPtr);
+    return true;
+  }
+
   return init(stream);
 }
 
@@ -77,6 +91,9 @@ bool NucleonExcitations::init(string path) {
 
 bool NucleonExcitations::init(istream& stream) {
 
+  // Tables to fill.
+  Tables& tables = tablesPtr.writable();
+
   // Lower bound, needed for total cross section parameterization.
   double eMin = INFINITY;
 
@@ -127,7 +144,7 @@ bool NucleonExcitations::init(istream& stream) {
         eMin = left;
 
       // Add channel to the list.
-      excitationChannels.push_back(ExcitationChannel {
+      tables.excitationChannels.push_back(ExcitationChannel {
           LinearInterpolator(left, right, data), maskA, maskB, scaleFactor });
     }
   }
@@ -138,11 +155,12 @@ bool NucleonExcitations::init(istream& stream) {
   for (int i = 0; i < sigmaTotalPrecision; ++i) {
     double eCM = eMin + i * dE;
     double sigma = 0.;
-    for (auto& channel : excitationChannels)
+    for (auto& channel : tables.excitationChannels)
       sigma += channel.sigma(eCM);
     sigmaTotPts[i] = sigma;
   }
-  sigmaTotal = LinearInterpolator(eMin, highEnergyThreshold, sigmaTotPts);
+  tables.sigmaTotal
+    = LinearInterpolator(eMin, highEnergyThreshold, sigmaTotPts);
 
   // Done.
   return true;
@@ -155,7 +173,7 @@ bool NucleonExcitations::init(istream& stream) {
 bool NucleonExcitations::check() {
 
   // Check that all excitations make sense.
-  for (auto excitationChannel : excitationChannels) {
+  for (auto excitationChannel : tablesPtr->excitationChannels) {
     // Check that ids actually correspond to particles.
     for (int mask : { excitationChannel.maskA, excitationChannel.maskB })
     for (int id : { mask + 2210, mask + 2110 })
@@ -187,19 +205,20 @@ bool NucleonExcitations::pickExcitation(int idA, int idB, double eCM,
   idB *= signB;
 
   // Pick an excitation channel.
-  vector<double> sigmas(excitationChannels.size());
+  const vector<ExcitationChannel>& channels = tablesPtr->excitationChannels;
+  vector<double> sigmas(channels.size());
   for (int i = 0; i < int(sigmas.size()); ++i) {
     // Below threshold, use parameterization.
-    if (eCM < excitationChannels[i].sigma.right())
-      sigmas[i] = excitationChannels[i].sigma(eCM);
+    if (eCM < channels[i].sigma.right())
+      sigmas[i] = channels[i].sigma(eCM);
     // Above threshold, use approximation (ignoring incoming phase space).
     else {
-      double mA = particleDataPtr->m0(2210 + excitationChannels[i].maskA);
-      double mB = particleDataPtr->m0(2210 + excitationChannels[i].maskB);
-      sigmas[i] = pCMS(eCM, mA, mB) * excitationChannels[i].scaleFactor;
+      double mA = particleDataPtr->m0(2210 + channels[i].maskA);
+      double mB = particleDataPtr->m0(2210 + channels[i].maskB);
+      sigmas[i] = pCMS(eCM, mA, mB) * channels[i].scaleFactor;
     }
   }
-  auto& channel = excitationChannels[rndmPtr->pick(sigmas)];
+  auto& channel = channels[rndmPtr->pick(sigmas)];
 
   // The two nucleons have equal chance of becoming excited.
   int maskA = channel.maskA, maskB = channel.maskB;
@@ -233,12 +252,12 @@ bool NucleonExcitations::pickExcitation(int idA, int idB, double eCM,
 
 double NucleonExcitations::sigmaExTotal(double eCM) const {
   // Below threshold, use parameterization.
-  if (eCM < sigmaTotal.right())
-    return sigmaTotal(eCM);
+  if (eCM < tablesPtr->sigmaTotal.right())
+    return tablesPtr->sigmaTotal(eCM);
   // Above threshold, sum approximated integrals.
   else {
     double sig = 0.;
-    for (auto channel : excitationChannels) {
+    for (auto channel : tablesPtr->excitationChannels) {
       double mA = particleDataPtr->m0(2210 + channel.maskA);
       double mB = particleDataPtr->m0(2210 + channel.maskB);
       sig += channel.scaleFactor * pCMS(eCM, mA, mB);
@@ -265,7 +284,7 @@ double NucleonExcitations::sigmaExPartial(double eCM,
     swap(maskC, maskD);
 
   // Find the corresponding channel.
-  for (auto& channel : excitationChannels)
+  for (auto& channel : tablesPtr->excitationChannels)
     if (channel.maskA == maskC && channel.maskB == maskD) {
       // At low energy, use interpolation.
       if (eCM < channel.sigma.right())
@@ -288,7 +307,7 @@ double NucleonExcitations::sigmaExPartial(double eCM,
 
 vector<pair<int, int>> NucleonExcitations::getChannels() const {
   vector<pair<int, int>> result;
-  for (auto channel : excitationChannels)
+  for (auto channel : tablesPtr->excitationChannels)
     result.push_back(make_pair(channel.maskA, channel.maskB));
   return result;
 }
@@ -391,7 +410,8 @@ bool NucleonExcitations::parameterizeAll(int precision, double threshold) {
   scaleFactorD *= 4;
 
   // Create new excitation channels.
-  excitationChannels.clear();
+  Tables& tables = tablesPtr.writable();
+  tables.excitationChannels.clear();
   for (auto maskEx : getExcitationMasks()) {
 
     int idEx = 2210 + maskEx;
@@ -427,7 +447,7 @@ bool NucleonExcitations::parameterizeAll(int precision, double threshold) {
     double scaleN = (maskEx == 0004) ? 0.
       : scaleFactorN * scaleFactorEx * (isDelta ? 12.0 : 6.3)
         / (pow2(mN - mEx) * pow2(mN + mEx));
-    excitationChannels.push_back(ExcitationChannel {
+    tables.excitationChannels.push_back(ExcitationChannel {
       LinearInterpolator(eMin, threshold, dataPointsNX),
       0002, maskEx, scaleN
     });
@@ -443,7 +463,7 @@ bool NucleonExcitations::parameterizeAll(int precision, double threshold) {
 
     double scaleD = scaleFactorD * scaleFactorEx *
       (maskEx == 0004 ? 2.8 : 3.5 / (pow2(mD - mEx) * pow2(mD + mEx)));
-    excitationChannels.push_back(ExcitationChannel {
+    tables.excitationChannels.push_back(ExcitationChannel {
       LinearInterpolator(eMin, threshold, dataPointsDX),
       0004, maskEx, scaleD
     });
@@ -456,10 +476,10 @@ bool NucleonExcitations::parameterizeAll(int precision, double threshold) {
   for (int ie = 0; ie < precision; ++ie) {
     double eNow = eMin + de * ie;
     sigmaTotPts[ie] = 0;
-    for (auto& channel : excitationChannels)
+    for (auto& channel : tables.excitationChannels)
       sigmaTotPts[ie] += channel.sigma(eNow);
   }
-  sigmaTotal = LinearInterpolator(eMin, threshold, sigmaTotPts);
+  tables.sigmaTotal = LinearInterpolator(eMin, threshold, sigmaTotPts);
 
   // Done.
   return true;
@@ -560,12 +580,13 @@ bool NucleonExcitations::save(ostream& stream) const {
 
   // Write header
   stream << "<header "
-         << "threshold=\"" << sigmaTotal.right() << "\" "
-         << "sigmaTotalPrecision=\"" << sigmaTotal.data().size() << "\" /> "
+         << "threshold=\"" << tablesPtr->sigmaTotal.right() << "\" "
+         << "sigmaTotalPrecision=\"" << tablesPtr->sigmaTotal.data().size()
+         << "\" /> "
          << endl << endl;
 
   // Write channels.
-  for (auto& channel : excitationChannels) {
+  for (auto& channel : tablesPtr->excitationChannels) {
     stream << "<excitationChannel "
            << "maskA=\"" << channel.maskA << "\" "
            << "maskB=\"" << channel.maskB << "\" "
@@ -11,6 +11,7 @@
 #include "Pythia8/StandardModel.h"
 #include "Pythia8/SusyResonanceWidths.h"
 #include "Pythia8/ResonanceWidthsDM.h"
+#include "Pythia8/Snapshot.h"
 
 // Allow string and character manipulation.
 #include <cctype>
@@ -70,6 +71,31 @@ bool DecayChannel::contains(int id1, int id2, int id3) const {
 
 }
 
+//--------------------------------------------------------------------------
+
+// Write the decay channel to a binary snapshot, or read it back.
+
+void DecayChannel::writeSnapshot(SnapshotWriter& writer) const {
+
+  writer.put(onModeSave); writer.put(bRatioSave); writer.put(currentBRSave);
+  writer.put(onShellWidthSave); writer.put(openSecPos);
+  writer.put(openSecNeg); writer.put(meModeSave); writer.put(nProd);
+  for (int j = 0; j < 8; ++j) writer.put(prod[j]);
+  writer.put(hasChangedSave);
+
+}
+
+bool DecayChannel::readSnapshot(SnapshotReader& reader) {
+
+  if (!reader.get(onModeSave) || !reader.get(bRatioSave)
+    || !reader.get(currentBRSave) || !reader.get(onShellWidthSave)
+    || !reader.get(openSecPos) || !reader.get(openSecNeg)
+    || !reader.get(meModeSave) || !reader.get(nProd)) return false;
+  for (int j = 0; j < 8; ++j) if (!reader.get(prod[j])) return false;
+  return reader.get(hasChangedSave);
+
+}
+
 //==========================================================================
 
 // ParticleDataEntry class.
@@ -591,6 +617,61 @@ double ParticleDataEntry::resWidthChan(double mHat, int idAbs1,
 
 //--------------------------------------------------------------------------
 
+// Write the particle properties, including decay channels, to a binary
+// snapshot. The pointers to other objects are not stored.
+
+void ParticleDataEntry::writeSnapshot(SnapshotWriter& writer) const {
+
+  writer.put(idSave); writer.put(nameSave); writer.put(antiNameSave);
+  writer.put(spinTypeSave); writer.put(chargeTypeSave);
+  writer.put(colTypeSave); writer.put(m0Save); writer.put(mWidthSave);
+  writer.put(mMinSave); writer.put(mMaxSave); writer.put(tau0Save);
+  writer.put(constituentMassSave); writer.put(hasAntiSave);
+  writer.put(isResonanceSave); writer.put(mayDecaySave);
+  writer.put(tauCalcSave); writer.put(varWidthSave);
+  writer.put(doExternalDecaySave); writer.put(isVisibleSave);
+  writer.put(doForceWidthSave); writer.put(hasChangedSave);
+  writer.put(hasChangedMMinSave); writer.put(hasChangedMMaxSave);
+  writer.put(modeBWnow); writer.put(modeTau0now); writer.put(atanLow);
+  writer.put(atanDif); writer.put(mThr); writer.put(currentBRSum);
+  writer.put(int(channels.size()));
+  for (const DecayChannel& channel : channels)
+    channel.writeSnapshot(writer);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read back the particle properties from a binary snapshot.
+
+bool ParticleDataEntry::readSnapshot(SnapshotReader& reader) {
+
+  int nChannels = 0;
+  if (!reader.get(idSave) || !reader.get(nameSave)
+    || !reader.get(antiNameSave) || !reader.get(spinTypeSave)
+    || !reader.get(chargeTypeSave) || !reader.get(colTypeSave)
+    || !reader.get(m0Save) || !reader.get(mWidthSave)
+    || !reader.get(mMinSave) || !reader.get(mMaxSave)
+    || !reader.get(tau0Save) || !reader.get(constituentMassSave)
+    || !reader.get(hasAntiSave) || !reader.get(isResonanceSave)
+    || !reader.get(mayDecaySave) || !reader.get(tauCalcSave)
+    || !reader.get(varWidthSave) || !reader.get(doExternalDecaySave)
+    || !reader.get(isVisibleSave) || !reader.get(doForceWidthSave)
+    || !reader.get(hasChangedSave) || !reader.get(hasChangedMMinSave)
+    || !reader.get(hasChangedMMaxSave) || !reader.get(modeBWnow)
+    || !reader.get(modeTau0now) || !reader.get(atanLow)
+    || !reader.get(atanDif) || !reader.get(mThr)
+    || !reader.get(currentBRSum) || !reader.get(nChannels)
+    || nChannels < 0) return false;
+  channels.resize(nChannels);
+  for (DecayChannel& channel : channels)
+    if (!channel.readSnapshot(reader)) return false;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Constituent masses for (d, u, s, c, b) quarks and diquarks.
 // Hardcoded in CONSTITUENTMASSTABLE so that they are not overwritten
 // by mistake, and separated from the "normal" masses.
@@ -623,6 +704,15 @@ void ParticleDataEntry::setConstituentMass() {
 
 //--------------------------------------------------------------------------
 
+// Constants: could be changed here if desired, but normally should not.
+// These are of technical nature, as described for each.
+
+// Codes below this value are found by direct indexing rather than by
+// a map search; the ground-state mesons and baryons have codes below it.
+const int ParticleData::DIRECTIDMAX = 10000;
+
+//--------------------------------------------------------------------------
+
 // Get data to be distributed among particles during setup.
 // Note: this routine is called twice. Firstly from init(...), but
 // the data should not be used at that point, so is likely overkill.
@@ -918,6 +1008,7 @@ bool ParticleData::copyXML(const ParticleData &particleDataIn) {
 
   // First Reset everything.
   pdt.clear();
+  rebuildIndex();
   xmlFileSav.clear();
   readStringHistory.resize(0);
   readStringSubrun.clear();
@@ -939,6 +1030,7 @@ bool ParticleData::loadXML(istream& is, bool reset) {
   // Normally reset whole database before beginning.
   if (reset) {
     pdt.clear();
+    rebuildIndex();
     xmlFileSav.clear();
     readStringHistory.resize(0);
     readStringSubrun.clear();
@@ -1036,7 +1128,7 @@ bool ParticleData::processXML(bool reset) {
       bool varWidthTmp   = boolAttributeValue( line, "varWidth");
 
       // Erase if particle already exists.
-      if (isParticle(idTmp)) pdt.erase(idTmp);
+      if (isParticle(idTmp)) {pdt.erase(idTmp); updateIndex(idTmp);}
 
       // Store new particle. Save pointer, to be used for decay channels.
       addParticle( idTmp, nameTmp, antiNameTmp, spinTypeTmp, chargeTypeTmp,
@@ -1167,6 +1259,7 @@ bool ParticleData::readFF(istream& is, bool reset) {
   // Normally reset whole database before beginning.
   if (reset) {
     pdt.clear();
+    rebuildIndex();
     readStringHistory.resize(0);
     readStringSubrun.clear();
     isInit = false;
@@ -1215,7 +1308,7 @@ bool ParticleData::readFF(istream& is, bool reset) {
       }
 
       // Erase if particle already exists.
-      if (isParticle(idTmp)) pdt.erase(idTmp);
+      if (isParticle(idTmp)) {pdt.erase(idTmp); updateIndex(idTmp);}
 
       // Store new particle. Save pointer, to be used for decay channels.
       addParticle( idTmp, nameTmp, antiNameTmp, spinTypeTmp, chargeTypeTmp,
@@ -1330,6 +1423,70 @@ void ParticleData::listFF(string outFile) {
 
 //--------------------------------------------------------------------------
 
+// Write the full database to a binary snapshot. The pointers to other
+// objects are not stored, and neither are the XML file lines.
+
+void ParticleData::writeSnapshot(SnapshotWriter& writer) const {
+
+  // Common data.
+  writer.put(setRapidDecayVertex);
+  writer.put(modeBreitWigner);
+  writer.put(maxEnhanceBW);
+  for (int i = 0; i < 7; ++i) writer.put(mQRun[i]);
+  writer.put(Lambda5Run);
+  writer.put(intermediateTau0);
+
+  // The particles.
+  writer.put(int(pdt.size()));
+  for (const auto& entry : pdt) {
+    writer.put(entry.first);
+    entry.second->writeSnapshot(writer);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Replace the full database by the contents of a binary snapshot.
+
+bool ParticleData::readSnapshot(SnapshotReader& reader) {
+
+  // Reset the database.
+  pdt.clear();
+  rebuildIndex();
+  xmlFileSav.clear();
+  readStringHistory.resize(0);
+  readStringSubrun.clear();
+  particlePtr = nullptr;
+  isInit = false;
+
+  // Common data.
+  if (!reader.get(setRapidDecayVertex) || !reader.get(modeBreitWigner)
+    || !reader.get(maxEnhanceBW)) return false;
+  for (int i = 0; i < 7; ++i) if (!reader.get(mQRun[i])) return false;
+  if (!reader.get(Lambda5Run) || !reader.get(intermediateTau0))
+    return false;
+
+  // The particles, which come sorted.
+  int nEntries = 0;
+  if (!reader.get(nEntries)) return false;
+  for (int i = 0; i < nEntries; ++i) {
+    int idIn = 0;
+    ParticleDataEntryPtr entryPtr = make_shared<ParticleDataEntry>();
+    if (!reader.get(idIn) || !entryPtr->readSnapshot(reader)) return false;
+    entryPtr->initPtr(this);
+    pdt.emplace_hint(pdt.end(), idIn, entryPtr);
+  }
+  rebuildIndex();
+
+  // Done.
+  isInit = true;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Read in updates from a character string, like a line of a file.
 // Is used by readString (and readFile) in Pythia.
 
@@ -1517,7 +1674,7 @@ void ParticleData::listFF(string outFile) {
 
     // Else start over completely from scratch.
     } else {
-      if (isParticle(idTmp)) pdt.erase(idTmp);
+      if (isParticle(idTmp)) {pdt.erase(idTmp); updateIndex(idTmp);}
       addParticle( idTmp, nameTmp, antiNameTmp, spinTypeTmp, chargeTypeTmp,
         colTypeTmp, m0Tmp, mWidthTmp, mMinTmp, mMaxTmp, tau0Tmp, varWidthTmp);
     }
@@ -403,9 +403,21 @@ double PDF::xfSea(int id, double x, double Q2) {
 
 //--------------------------------------------------------------------------
 
+// Constants: could be changed here if desired, but normally should not.
+// These are of technical nature, as described for each.
+
+// Number of flavours in the grid: g, d, u, s, c, b, antiquarks, gamma.
+const int LHAGrid1::NFLAV = 12;
+
+// Alignment in bytes of the grid storage, enough for any SIMD width.
+const int LHAGrid1::ALIGNBYTES = 64;
+
+//--------------------------------------------------------------------------
+
 // Initialize PDF: select data file and open stream.
 
-void LHAGrid1::init(string pdfWord, string pdfdataPath, Logger* loggerPtr) {
+void LHAGrid1::init(string pdfWord, string pdfdataPath, Logger* loggerPtr,
+  SharedTablesPtr sharedTablesPtr) {
 
   // Identify whether file number or name.
   if (pdfWord.length() > 9 && toLower(pdfWord).substr(0,9) == "lhagrid1:")
@@ -465,6 +477,14 @@ void LHAGrid1::init(string pdfWord, string pdfdataPath, Logger* loggerPtr) {
     return;
   }
 
+  // Reuse a grid read in from the same file by another object, if possible.
+  if (sharedTablesPtr) {
+    gridPtr = sharedTablesPtr->get<Grid>("LHAGrid1:" + dataFile,
+      [&]() { return readGrid( is, loggerPtr); });
+    isSet = (gridPtr != nullptr);
+    return;
+  }
+
   // Initialization with a stream.
   init( is, loggerPtr);
   is.close();
@@ -473,16 +493,29 @@ void LHAGrid1::init(string pdfWord, string pdfdataPath, Logger* loggerPtr) {
 
 //--------------------------------------------------------------------------
 
-// Initialize PDF: read in data grid from stream and set up interpolation.
+// Initialize PDF: read in data grid from stream.
 
 void LHAGrid1::init(istream& is, Logger* loggerPtr) {
 
+  gridPtr = readGrid( is, loggerPtr);
+  isSet   = (gridPtr != nullptr);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Read in data grid from stream and set up interpolation.
+
+shared_ptr<const LHAGrid1::Grid> LHAGrid1::readGrid(istream& is,
+  Logger* loggerPtr) {
+
   // Check that data stream is available.
   if (!is.good()) {
     printErr("LHAGrid1::init", "cannot read from stream", loggerPtr);
-    isSet = false;
-    return;
+    return nullptr;
   }
+  shared_ptr<Grid> newGridPtr = make_shared<Grid>();
+  Grid& grid = *newGridPtr;
 
   // Some local variables.
   string line;
@@ -491,36 +524,34 @@ void LHAGrid1::init(istream& is, Logger* loggerPtr) {
   double xNow, qNow, pdfNow;
 
   // Skip lines of header, until ---. Probe for next subgrid in Q space.
-  nqSub = 0;
+  grid.nqSub = 0;
   do getline( is, line);
   while (line.find("---") == string::npos);
   if (!is.good()) {
     printErr("LHAGrid1::init", "could not read data file", loggerPtr);
-    isSet = false;
-    return;
+    return nullptr;
   }
 
   // Read each subgrid.
   while (getline( is, line)) {
-    ++nqSub;
+    ++grid.nqSub;
 
     // Read in x grid; save for first, check it matches for later ones.
     istringstream isx(line);
-    if (nqSub == 1) {
+    if (grid.nqSub == 1) {
       while (isx >> xNow) {
-        xGrid.push_back( xNow);
-        lnxGrid.push_back( log(xNow));
+        grid.xGrid.push_back( xNow);
+        grid.lnxGrid.push_back( log(xNow));
       }
-      nx   = xGrid.size();
-      xMin = xGrid.front();
-      xMax = xGrid.back();
+      grid.nx   = grid.xGrid.size();
+      grid.xMin = grid.xGrid.front();
+      grid.xMax = grid.xGrid.back();
     } else {
       int ixc = -1;
       while (isx >> xNow)
-      if ( abs(log(xNow) - lnxGrid[++ixc]) > 1e-5) {
+      if ( abs(log(xNow) - grid.lnxGrid[++ixc]) > 1e-5) {
         printErr("LHAGrid1::init", "mismatched subgrid x spacing", loggerPtr);
-        isSet = false;
-        return;
+        return nullptr;
       }
     }
 
@@ -530,46 +561,40 @@ void LHAGrid1::init(istream& is, Logger* loggerPtr) {
     nqNow = 0;
     while (isq >> qNow) {
       ++nqNow;
-      qGrid.push_back( qNow);
-      lnqGrid.push_back( log(qNow));
+      grid.qGrid.push_back( qNow);
+      grid.lnqGrid.push_back( log(qNow));
     }
-    if (nqSub > 1) {
-      if (abs(qGrid[nq] / qGrid[nq-1] - 1.) > 1e-5) {
+    if (grid.nqSub > 1) {
+      if (abs(grid.qGrid[grid.nq] / grid.qGrid[grid.nq-1] - 1.) > 1e-5) {
         printErr("LHAGrid1::init", "mismatched subgrid Q borders", loggerPtr);
-        isSet = false;
-        return;
+        return nullptr;
       }
-      qGrid[nq-1] = 0.5 * (qGrid[nq-1] + qGrid[nq]);
-      qGrid[nq]   = qGrid[nq-1];
+      grid.qGrid[grid.nq-1]
+        = 0.5 * (grid.qGrid[grid.nq-1] + grid.qGrid[grid.nq]);
+      grid.qGrid[grid.nq]   = grid.qGrid[grid.nq-1];
     }
-    nq   = qGrid.size();
-    qMin = qGrid.front();
-    qMax = qGrid.back();
-    nqSum.push_back(nq);
-    qDiv.push_back(qMax);
+    grid.nq   = grid.qGrid.size();
+    grid.qMin = grid.qGrid.front();
+    grid.qMax = grid.qGrid.back();
+    grid.nqSum.push_back(grid.nq);
+    grid.qDiv.push_back(grid.qMax);
 
     // Read in and store flavour mapping and pdf data. Separator line.
     getline( is, line);
     idlines.push_back( line);
-    for (int ixq = 0; ixq < nx * nqNow; ++ixq) {
+    for (int ixq = 0; ixq < grid.nx * nqNow; ++ixq) {
       getline( is, line);
       pdflines.push_back( line);
     }
     getline( is, line);
   }
 
-  // Create array big enough to hold (flavour, x, Q) grid.
-  for (int iid = 0; iid < 12; ++iid) {
-    pdfGrid[iid] = new double*[nq];
-    for (int iq = 0; iq < nq; ++iq) {
-      pdfGrid[iid][iq] = new double[nx];
-      for (int ix = 0; ix < nx; ++ix) pdfGrid[iid][iq][ix] = 0.;
-    }
-  }
+  // Create array big enough to hold (Q, x, flavour) grid.
+  grid.allocate();
 
   // Second pass through the Q subranges.
   int iln = -1;
-  for (int iqSub = 0; iqSub < nqSub; ++iqSub) {
+  for (int iqSub = 0; iqSub < grid.nqSub; ++iqSub) {
     vector<int> idGridMap;
 
     // Study flavour grid and decide flavour mapping.
@@ -585,28 +610,47 @@ void LHAGrid1::init(istream& is, Logger* loggerPtr) {
     int nid = idGridMap.size();
 
     // Read in data grid, line by line.
-    int iq0 = (iqSub == 0) ? 0 : nqSum[iqSub - 1];
-    for (int ix = 0; ix < nx; ++ix)
-    for (int iq = iq0; iq < nqSum[iqSub]; ++iq) {
+    int iq0 = (iqSub == 0) ? 0 : grid.nqSum[iqSub - 1];
+    for (int ix = 0; ix < grid.nx; ++ix)
+    for (int iq = iq0; iq < grid.nqSum[iqSub]; ++iq) {
       istringstream ispdf( pdflines[++iln] );
       for (int iid = 0; iid < nid; ++iid) {
         ispdf >> pdfNow;
-        if (idGridMap[iid] >= 0) pdfGrid[idGridMap[iid]][iq][ix] = pdfNow;
+        if (idGridMap[iid] >= 0) grid.pdf(iq, ix)[idGridMap[iid]] = pdfNow;
       }
     }
   }
 
-  // For extrapolation to small x: create array for b values of x^b shape.
-  pdfSlope = new double*[12];
-  for (int iid = 0; iid < 12; ++iid) {
-    pdfSlope[iid] = new double[nq];
-    for (int iq = 0; iq < nq; ++iq) { pdfSlope[iid][iq] =
-      ( min( pdfGrid[iid][iq][0], pdfGrid[iid][iq][1]) > 1e-5
-      && abs(lnxGrid[1] - lnxGrid[0]) > 1e-5)
-      ? ( log(pdfGrid[iid][iq][1]) - log(pdfGrid[iid][iq][0]) )
-      / (lnxGrid[1] - lnxGrid[0]) : 0.;
-    }
+  // For extrapolation to small x: b values of x^b shape.
+  for (int iq = 0; iq < grid.nq; ++iq) {
+    const double* pdf0 = grid.pdf(iq, 0);
+    const double* pdf1 = grid.pdf(iq, 1);
+    double* slope = grid.pdfSlope + iq * NFLAV;
+    for (int iid = 0; iid < NFLAV; ++iid) slope[iid] =
+      ( min( pdf0[iid], pdf1[iid]) > 1e-5
+      && abs(grid.lnxGrid[1] - grid.lnxGrid[0]) > 1e-5)
+      ? ( log(pdf1[iid]) - log(pdf0[iid]) )
+      / (grid.lnxGrid[1] - grid.lnxGrid[0]) : 0.;
   }
+  return newGridPtr;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Allocate zeroed grid storage, with pointers aligned to ALIGNBYTES.
+
+void LHAGrid1::Grid::allocate() {
+
+  int nPad = ALIGNBYTES / sizeof(double);
+  pdfStore.assign( nq * nx * NFLAV + nPad, 0.);
+  slopeStore.assign( nq * NFLAV + nPad, 0.);
+  auto align = [](vector<double>& store) {
+    size_t offset = reinterpret_cast<size_t>(store.data()) % ALIGNBYTES;
+    return store.data() + (ALIGNBYTES - offset) % ALIGNBYTES / sizeof(double);
+  };
+  pdfGrid  = align(pdfStore);
+  pdfSlope = align(slopeStore);
 
 }
 
@@ -645,102 +689,139 @@ void LHAGrid1::xfUpdate(int , double x, double Q2) {
 
 //--------------------------------------------------------------------------
 
-void LHAGrid1::xfxevolve(double x, double Q2) {
-
-  // Find if (x, Q) inside our outside grid.
-  double q = sqrt(Q2);
-  int inx  = (x <= xMin) ? -1 : ((x >= xMax) ? 1 : 0);
-  int inq  = (q <= qMin) ? -1 : ((q >= qMax) ? 1 : 0);
-
-  // Set up default for x interpolation.
-  int    minx  = 0;
-  int    maxx  = nx - 1;
-  int    m3x   = 0;
-  double wx[4] = {1., 1., 1., 1.};
-
-  // Find grid value on either side of x.
-  if (inx == 0) {
-    int midx;
-    while (maxx - minx > 1) {
-      midx = (minx + maxx) / 2;
-      if (x < xGrid[midx]) maxx = midx;
-      else                 minx = midx;
-    }
+void LHAGrid1::xfAll(const vector<double>& x, const vector<double>& Q2,
+  vector<double>& xfs) const {
 
-    // Weights for cubic interpolation in ln(x).
-    double lnx = log(x);
-    if      (minx == 0)      m3x = 0;
-    else if (maxx == nx - 1) m3x = nx - 4;
-    else                     m3x = minx - 1;
-    for (int i3 = 0; i3 < 4; ++i3)
-    for (int j = 0; j < 4; ++j) if (j != i3)
-      wx[i3] *= (lnx - lnxGrid[m3x+j]) / (lnxGrid[m3x+i3] - lnxGrid[m3x+j]);
-  }
+  // Values are zero where not set by the interpolation.
+  int nPoint = min( x.size(), Q2.size());
+  xfs.assign( nPoint * NFLAV, 0.);
+  if (isSet && nPoint > 0) xfxevolve( nPoint, &x[0], &Q2[0], &xfs[0]);
 
-  // Find q subgrid and set up default for q interpolation.
-  int    iqDiv = 0;
-  for (int iqSub = 1; iqSub < nqSub; ++iqSub)
-    if (q > qDiv[iqSub - 1]) iqDiv = iqSub;
-  int    minS  = (iqDiv == 0) ? 0 : nqSum[iqDiv - 1];
-  int    maxS  = nqSum[iqDiv] - 1;
-  int    minq  = minS;
-  int    maxq  = maxS;
-  int    n3q   = 4;
-  int    m3q   = 0.;
-  double wq[4] = {1., 1., 1., 1.};
-
-  // Find grid value on either side of q.
-  if (inq == 0) {
-    int midq;
-    while (maxq - minq > 1) {
-      midq = (minq + maxq) / 2;
-      if (q < qGrid[midq]) maxq = midq;
-      else                 minq = midq;
-    }
+}
 
-    // Weights for linear or cubic interpolation in ln(q).
-    double lnq = log(q);
-    if (maxS - minS < 3) {
-      n3q = 2;
-      m3q = minq;
-      wq[1] = (lnq - lnqGrid[minq]) / (lnqGrid[maxq] - lnqGrid[minq]);
-      wq[0] = 1. - wq[1];
-    } else {
-      if      (minq == minS) m3q = minS;
-      else if (maxq == maxS) m3q = maxS - 3;
-      else                   m3q = minq - 1;
+//--------------------------------------------------------------------------
+
+// Interpolate in the grid for all flavours at a number of points. For
+// each point the grid search and the interpolation weights are found
+// first, after which all flavours are interpolated together, with the
+// same order of operations for each flavour as for a single flavour.
+
+void LHAGrid1::xfxevolve(int nPoint, const double* xIn, const double* Q2In,
+  double* xfs) const {
+
+  // Grid to interpolate in.
+  const Grid& grid = *gridPtr;
+
+  // Loop over points.
+  for (int iPoint = 0; iPoint < nPoint; ++iPoint) {
+    double x   = xIn[iPoint];
+    double* xf = xfs + iPoint * NFLAV;
+
+    // Find if (x, Q) inside our outside grid.
+    double q = sqrt(Q2In[iPoint]);
+    int inx  = (x <= grid.xMin) ? -1 : ((x >= grid.xMax) ? 1 : 0);
+    int inq  = (q <= grid.qMin) ? -1 : ((q >= grid.qMax) ? 1 : 0);
+
+    // Set up default for x interpolation.
+    int    minx  = 0;
+    int    maxx  = grid.nx - 1;
+    int    m3x   = 0;
+    double wx[4] = {1., 1., 1., 1.};
+
+    // Find grid value on either side of x.
+    if (inx == 0) {
+      int midx;
+      while (maxx - minx > 1) {
+        midx = (minx + maxx) / 2;
+        if (x < grid.xGrid[midx]) maxx = midx;
+        else                      minx = midx;
+      }
+
+      // Weights for cubic interpolation in ln(x).
+      double lnx = log(x);
+      if      (minx == 0)           m3x = 0;
+      else if (maxx == grid.nx - 1) m3x = grid.nx - 4;
+      else                          m3x = minx - 1;
       for (int i3 = 0; i3 < 4; ++i3)
       for (int j = 0; j < 4; ++j) if (j != i3)
-        wq[i3] *= (lnq - lnqGrid[m3q+j]) / (lnqGrid[m3q+i3] - lnqGrid[m3q+j]);
+        wx[i3] *= (lnx - grid.lnxGrid[m3x+j])
+          / (grid.lnxGrid[m3x+i3] - grid.lnxGrid[m3x+j]);
     }
 
-  // Freeze at border of q range.
-  } else {
-    n3q = 1;
-    if (inq == 1) m3q = nq - 1;
-  }
+    // Find q subgrid and set up default for q interpolation.
+    int    iqDiv = 0;
+    for (int iqSub = 1; iqSub < grid.nqSub; ++iqSub)
+      if (q > grid.qDiv[iqSub - 1]) iqDiv = iqSub;
+    int    minS  = (iqDiv == 0) ? 0 : grid.nqSum[iqDiv - 1];
+    int    maxS  = grid.nqSum[iqDiv] - 1;
+    int    minq  = minS;
+    int    maxq  = maxS;
+    int    n3q   = 4;
+    int    m3q   = 0.;
+    double wq[4] = {1., 1., 1., 1.};
+
+    // Find grid value on either side of q.
+    if (inq == 0) {
+      int midq;
+      while (maxq - minq > 1) {
+        midq = (minq + maxq) / 2;
+        if (q < grid.qGrid[midq]) maxq = midq;
+        else                      minq = midq;
+      }
 
-  // Interpolate between grid elements, normally bicubic, or simpler in ln(q).
-  if (inx == 0) {
-    for (int iid = 0; iid < 12; ++iid) {
-      double **ppdf = pdfGrid[iid] + m3q;
-      double sum0 = 0.;
-      for (int i3q = 0; i3q < n3q; ++i3q) {
-        double *pdf = ppdf[i3q] + m3x;
-        sum0 +=  wq[i3q] * (wx[0] * pdf[0] + wx[1] * pdf[1] + wx[2] * pdf[2]
-              + wx[3] * pdf[3] );
+      // Weights for linear or cubic interpolation in ln(q).
+      double lnq = log(q);
+      if (maxS - minS < 3) {
+        n3q = 2;
+        m3q = minq;
+        wq[1] = (lnq - grid.lnqGrid[minq])
+          / (grid.lnqGrid[maxq] - grid.lnqGrid[minq]);
+        wq[0] = 1. - wq[1];
+      } else {
+        if      (minq == minS) m3q = minS;
+        else if (maxq == maxS) m3q = maxS - 3;
+        else                   m3q = minq - 1;
+        for (int i3 = 0; i3 < 4; ++i3)
+        for (int j = 0; j < 4; ++j) if (j != i3)
+          wq[i3] *= (lnq - grid.lnqGrid[m3q+j])
+            / (grid.lnqGrid[m3q+i3] - grid.lnqGrid[m3q+j]);
       }
-      pdfVal[iid] = sum0;
+
+    // Freeze at border of q range.
+    } else {
+      n3q = 1;
+      if (inq == 1) m3q = grid.nq - 1;
     }
 
-  // Special: extrapolate to small x. (Let vanish at large x, so no such code.)
-  } else if (inx == -1) {
-    for (int iid = 0; iid < 12; ++iid) {
-      pdfVal[iid] = 0.;
-      for (int i3q = 0; i3q < n3q; ++i3q)
-        pdfVal[iid] += wq[i3q] * pdfGrid[iid][m3q+i3q][0]
-          * (doExtraPol ? pow( x / xMin, pdfSlope[iid][m3q+i3q]) : 1.);
+    // Interpolate between grid elements, normally bicubic, or simpler
+    // in ln(q).
+    if (inx == 0) {
+      double sum[NFLAV] = {};
+      for (int i3q = 0; i3q < n3q; ++i3q) {
+        const double* pdf0 = grid.pdf( m3q + i3q, m3x);
+        const double* pdf1 = pdf0 + NFLAV;
+        const double* pdf2 = pdf1 + NFLAV;
+        const double* pdf3 = pdf2 + NFLAV;
+        for (int iid = 0; iid < NFLAV; ++iid)
+          sum[iid] += wq[i3q] * (wx[0] * pdf0[iid] + wx[1] * pdf1[iid]
+            + wx[2] * pdf2[iid] + wx[3] * pdf3[iid] );
+      }
+      for (int iid = 0; iid < NFLAV; ++iid) xf[iid] = sum[iid];
+
+    // Special: extrapolate to small x. (Let vanish at large x, so no such
+    // code.)
+    } else if (inx == -1) {
+      for (int iid = 0; iid < NFLAV; ++iid) xf[iid] = 0.;
+      for (int i3q = 0; i3q < n3q; ++i3q) {
+        const double* pdf0  = grid.pdf( m3q + i3q, 0);
+        const double* slope = grid.slope( m3q + i3q);
+        for (int iid = 0; iid < NFLAV; ++iid)
+          xf[iid] += wq[i3q] * pdf0[iid]
+            * (doExtraPol ? pow( x / grid.xMin, slope[iid]) : 1.);
+      }
     }
+
+  // End of loop over points.
   }
 
 }
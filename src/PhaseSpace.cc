@@ -26,6 +26,9 @@ const int    PhaseSpace::NMAXTRY        = 2;
 // Number of three-body trials in phase space optimization.
 const int    PhaseSpace::NTRY3BODY      = 20;
 
+// Number of values stored for reuse of the 2 -> 1/2/3 sampling setup.
+const int    PhaseSpace::NSAMPLINGDATA  = 54;
+
 // Maximum cross section increase, just in case true maximum not found.
 const double PhaseSpace::SAFETYMARGIN   = 1.05;
 
@@ -501,6 +504,10 @@ bool PhaseSpace::setupSampling123(bool is2, bool is3) {
   if (showSearch) cout <<  "\n PYTHIA Optimization printout for "
     << sigmaProcessPtr->name() << "\n \n" << scientific << setprecision(3);
 
+  // Reset status of reused sampling data.
+  hasSampling123    = false;
+  reusedSampling123 = false;
+
   // Check that open range in tau (+ set tauMin, tauMax).
   if (!limitTau(is2, is3)) return false;
 
@@ -594,6 +601,18 @@ bool PhaseSpace::setupSampling123(bool is2, bool is3) {
   yCoef[2]   = 0.5;
   zCoef[0]   = 1.;
 
+  // Use coefficients and maximum from a previous initialization if given.
+  if (samplingIn.size() > 0) {
+    reusedSampling123 = loadSampling123();
+    samplingIn.clear();
+    if (reusedSampling123) {
+      hasSampling123 = true;
+      if (showSearch) cout << " Reused maximum = " << setw(11) << sigmaMx
+        << endl;
+      return true;
+    }
+  }
+
   // Step through grid in tau. Set limits on y and z generation.
   for (int iTau = 0; iTau < nTau; ++iTau) {
     double posTau = 0.5;
@@ -975,6 +994,7 @@ bool PhaseSpace::setupSampling123(bool is2, bool is3) {
   }
   sigmaMx *= SAFETYMARGIN;
   sigmaPos = sigmaMx;
+  hasSampling123 = true;
 
   // Optional printout.
   if (showSearch) cout << "\n Final maximum = "  << setw(11) << sigmaMx
@@ -986,6 +1006,62 @@ bool PhaseSpace::setupSampling123(bool is2, bool is3) {
 
 //--------------------------------------------------------------------------
 
+// Give back the maximum and the coefficients for optimized selection in
+// 2 -> 1/2/3, so that they can be reused by a later initialization.
+
+vector<double> PhaseSpace::samplingData() const {
+
+  // Only available after a successful setupSampling123.
+  vector<double> dataOut;
+  if (!hasSampling123) return dataOut;
+  dataOut.reserve(NSAMPLINGDATA);
+  dataOut.push_back(nTau);
+  dataOut.push_back(nY);
+  dataOut.push_back(nZ);
+  for (int i = 0; i < 8; ++i) dataOut.push_back(tauCoef[i]);
+  for (int i = 0; i < 8; ++i) dataOut.push_back(yCoef[i]);
+  for (int i = 0; i < 8; ++i) dataOut.push_back(zCoef[i]);
+  for (int i = 0; i < 8; ++i) dataOut.push_back(tauCoefSum[i]);
+  for (int i = 0; i < 8; ++i) dataOut.push_back(yCoefSum[i]);
+  for (int i = 0; i < 8; ++i) dataOut.push_back(zCoefSum[i]);
+  dataOut.push_back(sigmaMx);
+  dataOut.push_back(sigmaPos);
+  dataOut.push_back(sigmaNeg);
+  return dataOut;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Set the maximum and the coefficients for optimized selection in
+// 2 -> 1/2/3 from a previous initialization. Require that the number of
+// coefficients agrees with the current setup.
+
+bool PhaseSpace::loadSampling123() {
+
+  // Check that data matches current setup.
+  if (int(samplingIn.size()) != NSAMPLINGDATA) return false;
+  if (int(samplingIn[0]) != nTau || int(samplingIn[1]) != nY
+    || int(samplingIn[2]) != nZ || samplingIn[NSAMPLINGDATA - 3] <= 0.)
+    return false;
+
+  // Read out coefficients and maximum.
+  int iData = 3;
+  for (int i = 0; i < 8; ++i) tauCoef[i]    = samplingIn[iData++];
+  for (int i = 0; i < 8; ++i) yCoef[i]      = samplingIn[iData++];
+  for (int i = 0; i < 8; ++i) zCoef[i]      = samplingIn[iData++];
+  for (int i = 0; i < 8; ++i) tauCoefSum[i] = samplingIn[iData++];
+  for (int i = 0; i < 8; ++i) yCoefSum[i]   = samplingIn[iData++];
+  for (int i = 0; i < 8; ++i) zCoefSum[i]   = samplingIn[iData++];
+  sigmaMx  = samplingIn[iData++];
+  sigmaPos = samplingIn[iData++];
+  sigmaNeg = samplingIn[iData];
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Select a trial kinematics phase space point.
 // Note: by In is meant the integral over the quantity multiplying
 // coefficient cn. The sum of cn is normalized to unity.
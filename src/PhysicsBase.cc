@@ -6,6 +6,7 @@
 // Function definitions (not found in the header) for the PhysicsBase class.
 
 #include "Pythia8/BeamSetup.h"
+#include "Pythia8/ParticleData.h"
 #include "Pythia8/PhysicsBase.h"
 
 namespace Pythia8 {
@@ -85,6 +86,127 @@ void PhysicsBase::stat() {
     subObjectPtr->stat();
 }
 
+//--------------------------------------------------------------------------
+
+// Key identifying the setup: a hash of all changed settings, except those
+// starting with one of the given (lowercase) prefixes, of the particle
+// data and of the beams, plus an extra description of input that is not
+// in the settings, like an SLHA spectrum. Used to decide whether
+// initialization data calculated in another run or by another Pythia
+// object can be reused.
+
+string PhysicsBase::setupKey(const vector<string>& skipKeys,
+  const string& extra) const {
+
+  // Check whether a setting should be left out.
+  auto skip = [&](const string& keyNow) {
+    for (const string& skipNow : skipKeys)
+      if (keyNow.compare(0, skipNow.size(), skipNow) == 0) return true;
+    return false;
+  };
+
+  // Write all changed settings, with full precision.
+  ostringstream os;
+  os << scientific << setprecision(17);
+  for (auto& entry : settingsPtr->getFlagMap(""))
+    if (entry.second.valNow != entry.second.valDefault && !skip(entry.first))
+      os << entry.first << " " << entry.second.valNow << "\n";
+  for (auto& entry : settingsPtr->getModeMap(""))
+    if (entry.second.valNow != entry.second.valDefault && !skip(entry.first))
+      os << entry.first << " " << entry.second.valNow << "\n";
+  for (auto& entry : settingsPtr->getParmMap(""))
+    if (entry.second.valNow != entry.second.valDefault && !skip(entry.first))
+      os << entry.first << " " << entry.second.valNow << "\n";
+  for (auto& entry : settingsPtr->getWordMap(""))
+    if (entry.second.valNow != entry.second.valDefault && !skip(entry.first))
+      os << entry.first << " " << entry.second.valNow << "\n";
+  for (auto& entry : settingsPtr->getFVecMap(""))
+    if (entry.second.valNow != entry.second.valDefault && !skip(entry.first))
+      for (bool valNow : entry.second.valNow)
+        os << entry.first << " " << valNow << "\n";
+  for (auto& entry : settingsPtr->getMVecMap(""))
+    if (entry.second.valNow != entry.second.valDefault && !skip(entry.first))
+      for (int valNow : entry.second.valNow)
+        os << entry.first << " " << valNow << "\n";
+  for (auto& entry : settingsPtr->getPVecMap(""))
+    if (entry.second.valNow != entry.second.valDefault && !skip(entry.first))
+      for (double valNow : entry.second.valNow)
+        os << entry.first << " " << valNow << "\n";
+  for (auto& entry : settingsPtr->getWVecMap(""))
+    if (entry.second.valNow != entry.second.valDefault && !skip(entry.first))
+      for (const string& valNow : entry.second.valNow)
+        os << entry.first << " " << valNow << "\n";
+
+  // Write masses, widths and decay channels of all particles.
+  writeParticleData(os);
+
+  // Write beams, and the extra description.
+  os << infoPtr->idA() << " " << infoPtr->idB() << " " << infoPtr->eCM()
+     << "\n" << extra;
+
+  // Hash of the full description.
+  return hashKey(os.str());
+
+}
+
+//--------------------------------------------------------------------------
+
+// Key identifying the particle data: a hash of the masses, widths and
+// decay channels of all particles. Used for tables that are built partly
+// from the particle data, like those of the hadron widths. The key found
+// at the start of Pythia::init() is reused, if there is one.
+
+string PhysicsBase::particleDataKey() const {
+
+  if (!infoPtr->sharedTablesKey.empty()) return infoPtr->sharedTablesKey;
+  ostringstream os;
+  os << scientific << setprecision(17);
+  writeParticleData(os);
+  return hashKey(os.str());
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write the masses, widths and decay channels of all particles.
+
+void PhysicsBase::writeParticleData(ostream& os) const {
+
+  for (auto pdtEntry = particleDataPtr->begin();
+       pdtEntry != particleDataPtr->end(); ++pdtEntry) {
+    ParticleDataEntryPtr ptr = pdtEntry->second;
+    os << ptr->id() << " " << ptr->m0() << " " << ptr->mWidth() << " "
+       << ptr->mMin() << " " << ptr->mMax() << " " << ptr->tau0() << " "
+       << ptr->varWidth() << "\n";
+    for (int i = 0; i < ptr->sizeChannels(); ++i) {
+      const DecayChannel& channel = ptr->channel(i);
+      os << channel.onMode() << " " << channel.bRatio() << " "
+         << channel.meMode();
+      for (int j = 0; j < channel.multiplicity(); ++j)
+        os << " " << channel.product(j);
+      os << "\n";
+    }
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// 64-bit FNV-1a hash of a description, as hexadecimal string.
+
+string PhysicsBase::hashKey(const string& description) {
+
+  uint64_t hash = 14695981039346656037ULL;
+  for (unsigned char c : description) {
+    hash ^= c;
+    hash *= 1099511628211ULL;
+  }
+  ostringstream keyOut;
+  keyOut << std::hex << setw(16) << std::setfill('0') << hash;
+  return keyOut.str();
+
+}
+
 //==========================================================================
 
 } // end namespace Pythia8
@@ -215,16 +215,28 @@ bool ProcessContainer::init(bool isFirst, ResonanceDecays* resDecaysPtrIn,
   sigmaProcessPtr->initProc();
   if (!sigmaProcessPtr->initFlux()) return false;
 
-  // Find maximum of differential cross section * phasespace.
-  bool physical       = phaseSpacePtr->setupSampling();
-  sigmaMx             = phaseSpacePtr->sigmaMax();
+  // Find maximum of differential cross section * phasespace. Optionally
+  // reuse the maximum and sampling coefficients of a previous run, also
+  // skipping the trial events below. Unphysical processes are only marked.
+  bool physical       = false;
+  bool reuseWorked    = false;
+  if (samplingSave.size() >= 3 && samplingSave[0] == 0.) reuseWorked = true;
+  else {
+    if (samplingSave.size() > 3) phaseSpacePtr->setSamplingData(
+      vector<double>( samplingSave.begin() + 3, samplingSave.end()) );
+    physical          = phaseSpacePtr->setupSampling();
+    reuseWorked       = physical && phaseSpacePtr->reusedSampling();
+  }
+  sigmaMx             = (reuseWorked) ? samplingSave[1]
+                      : phaseSpacePtr->sigmaMax();
   double sigmaHalfWay = sigmaMx;
 
   // Separate signed maximum needed for LHA with negative weight.
-  sigmaSgn            = phaseSpacePtr->sigmaSumSigned();
+  sigmaSgn            = (reuseWorked) ? samplingSave[2]
+                      : phaseSpacePtr->sigmaSumSigned();
 
   // Check maximum by a few events, and extrapolate a further increase.
-  if (physical & !isLHA && !isSoftQCD()) {
+  if (physical & !isLHA && !isSoftQCD() && !reuseWorked) {
     int nSample = (nFin < 3) ? N12SAMPLE : N3SAMPLE;
     for (int iSample = 0; iSample < nSample; ++iSample) {
       bool test = false;
@@ -237,6 +249,17 @@ bool ProcessContainer::init(bool isFirst, ResonanceDecays* resDecaysPtrIn,
     phaseSpacePtr->setSigmaMax(sigmaMx);
   }
 
+  // Store maximum and sampling data, so that they can be saved for reuse.
+  samplingSave.clear();
+  vector<double> phaseSpaceData = phaseSpacePtr->samplingData();
+  if (!isLHA && ((!physical && sigmaMx <= 0.) || phaseSpaceData.size() > 0)) {
+    samplingSave.push_back( (physical) ? 1. : 0.);
+    samplingSave.push_back(sigmaMx);
+    samplingSave.push_back(sigmaSgn);
+    samplingSave.insert( samplingSave.end(), phaseSpaceData.begin(),
+      phaseSpaceData.end());
+  }
+
   // Allow Pythia to overwrite incoming beams or parts of Les Houches input.
   idRenameBeams = mode("LesHouches:idRenameBeams");
   setLifetime   = mode("LesHouches:setLifetime");
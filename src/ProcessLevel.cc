@@ -5,6 +5,7 @@
 
 // Function definitions (not found in the header) for the ProcessLevel class.
 
+#include "Pythia8/BeamSetup.h"
 #include "Pythia8/ProcessLevel.h"
 
 namespace Pythia8 {
@@ -143,6 +144,7 @@ bool ProcessLevel::init( bool doLHA, SLHAinterface* slhaInterfacePtrIn,
   // Set up containers for all the internal hard processes.
   SetupContainers setupContainers;
   setupContainers.init(containerPtrs, infoPtr);
+  int nIntern = containerPtrs.size();
 
   // Append containers for external hard processes, if any.
   if (sigmaPtrs.size() > 0) {
@@ -199,6 +201,33 @@ bool ProcessLevel::init( bool doLHA, SLHAinterface* slhaInterfacePtrIn,
     return false;
   }
 
+  // Read maxima and sampling data of internal processes from file, to
+  // save time. Not possible if user hooks modify the cross sections,
+  // or if PDFs have been passed in, since then the key cannot tell
+  // whether the data still apply.
+  reuseInit = mode("PhaseSpace:reuseInit");
+  initFile  = word("PhaseSpace:initFile");
+  if (reuseInit > 0 && userHooksPtr != 0 && (userHooksPtr->canModifySigma()
+    || userHooksPtr->canBiasSelection()) ) {
+    loggerPtr->WARNING_MSG("cannot reuse initialization when user hooks"
+      " modify cross sections");
+    reuseInit = 0;
+  }
+  if (reuseInit > 0 && beamSetupPtr != nullptr
+    && beamSetupPtr->hasUserPDFs()) {
+    loggerPtr->WARNING_MSG("cannot reuse initialization when PDFs"
+      " are passed in by the user");
+    reuseInit = 0;
+  }
+  string key       = (reuseInit > 0) ? initKey() : "";
+  bool reuseWorked = (reuseInit == 2 || reuseInit == 3)
+    && loadSamplingData(key);
+  if (reuseInit == 2 && !reuseWorked) {
+    loggerPtr->ABORT_MSG("failed to load phase space data");
+    return false;
+  }
+  if (reuseWorked) setSamplingData( 0, containerPtrs, nIntern);
+
   // Initialize each process.
   int numberOn = 0;
   for (int i = 0; i < int(containerPtrs.size()); ++i)
@@ -219,6 +248,8 @@ bool ProcessLevel::init( bool doLHA, SLHAinterface* slhaInterfacePtrIn,
       loggerPtr->ERROR_MSG("no second hard process switched on");
       return false;
     }
+    if (reuseWorked)
+      setSamplingData( 1, container2Ptrs, container2Ptrs.size());
     for (int i2 = 0; i2 < int(container2Ptrs.size()); ++i2)
       if (container2Ptrs[i2]->init(false, &resonanceDecays,
         slhaInterfacePtr, &gammaKin)) ++number2On;
@@ -228,6 +259,14 @@ bool ProcessLevel::init( bool doLHA, SLHAinterface* slhaInterfacePtrIn,
       sigma2MaxSum += container2Ptrs[i2]->sigmaMax();
   }
 
+  // Write maxima and sampling data to file, for reuse in later runs.
+  if (reuseInit == 1 || (reuseInit == 3 && !reuseWorked) ) {
+    if (saveSamplingData(key, nIntern))
+      loggerPtr->INFO_MSG("wrote initialization data to file", initFile);
+  }
+  samplingIn[0].clear();
+  samplingIn[1].clear();
+
   // Check whether to create event weight from components.
   doWt2 = !doLHA && !bias2Sel && !settings.flag("PhaseSpace:increaseMaximum");
 
@@ -1828,6 +1867,162 @@ void ProcessLevel::statistics2(bool reset) {
 
 }
 
+//--------------------------------------------------------------------------
+
+// Key identifying the setup for which maxima and sampling data are valid:
+// a hash of all changed settings, the particle data, the beams and the
+// contents of any SLHA spectrum read in.
+// Settings that cannot affect the maxima, like random number seeds and
+// the number of events, are left out so that batch jobs can share a file.
+
+string ProcessLevel::initKey() {
+
+  // Settings that do not affect process initialization.
+  static const vector<string> skipKeys = { "main:", "next:", "random:",
+    "print:", "init:", "stat:", "check:", "parallelism:",
+    "phasespace:reuseinit", "phasespace:initfile", "phasespace:showsearch",
+    "phasespace:showviolation", "multipartoninteractions:reuseinit",
+    "multipartoninteractions:initfile" };
+  string slhaContents = (slhaInterfacePtr != nullptr)
+    ? slhaInterfacePtr->slha.contents() : "";
+  return setupKey(skipKeys, slhaContents);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Send maxima and sampling data read from file to the process containers.
+// Require that the process code agrees.
+
+void ProcessLevel::setSamplingData(int iSet, vector<ProcessContainer*>& ptrs,
+  int nPtrs) {
+
+  for (int i = 0; i < nPtrs; ++i) {
+    auto dataPtr = samplingIn[iSet].find(i);
+    if (dataPtr == samplingIn[iSet].end()) continue;
+    const vector<double>& dataNow = dataPtr->second;
+    if (int(dataNow[0]) != ptrs[i]->code()) continue;
+    ptrs[i]->setSamplingData( vector<double>(dataNow.begin() + 1,
+      dataNow.end()) );
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Load maxima and sampling data from file, to save startup time.
+
+bool ProcessLevel::loadSamplingData(string key) {
+
+  // Open file for reading.
+  const char* cstring = initFile.c_str();
+  ifstream is(cstring);
+  if (!is.good()) {
+    loggerPtr->ERROR_MSG("could not open file", initFile);
+    return false;
+  }
+
+  // Read in one line at a time. Search for header of wanted key.
+  bool foundMatch = false;
+  int nData = 0;
+  string line;
+  while ( getline(is, line) ) {
+    istringstream matchHeader(line);
+    string tag, keyIn, tag2;
+    matchHeader >> tag;
+    if (tag != "======key=") continue;
+    matchHeader >> keyIn;
+    if (keyIn != key) continue;
+    foundMatch = true;
+    matchHeader >> tag2 >> nData;
+    break;
+  }
+  if (!foundMatch) return false;
+
+  // Each line contains set, container index, code and data.
+  samplingIn[0].clear();
+  samplingIn[1].clear();
+  for (int iData = 0; iData < nData; ++iData) {
+    if (!getline(is, line)) return false;
+    istringstream readData(line);
+    int iSet, iPtr, code, nValues;
+    readData >> iSet >> iPtr >> code >> nValues;
+    if (!readData || iSet < 0 || iSet > 1 || nValues < 0) return false;
+    vector<double> dataNow(nValues + 1);
+    dataNow[0] = code;
+    for (int i = 1; i <= nValues; ++i) readData >> dataNow[i];
+    if (!readData) return false;
+    samplingIn[iSet][iPtr] = dataNow;
+  }
+
+  // Close file. Done.
+  is.close();
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write maxima and sampling data to file, to save startup time.
+// Data for several setups can be stored in the same file.
+
+bool ProcessLevel::saveSamplingData(string key, int nIntern) {
+
+  // Collect data to be written.
+  vector<string> lines;
+  for (int iSet = 0; iSet < 2; ++iSet) {
+    vector<ProcessContainer*>& ptrs = (iSet == 0) ? containerPtrs
+      : container2Ptrs;
+    int nPtrs = (iSet == 0) ? nIntern : ptrs.size();
+    for (int i = 0; i < nPtrs; ++i) {
+      vector<double> dataNow = ptrs[i]->samplingData();
+      if (dataNow.size() == 0) continue;
+      ostringstream os;
+      os << iSet << " " << i << " " << ptrs[i]->code() << " "
+         << dataNow.size() << scientific << setprecision(17);
+      for (double value : dataNow) os << " " << value;
+      lines.push_back(os.str());
+    }
+  }
+
+  // Keep the contents of an existing file, except an earlier block of
+  // data for the same setup, so that repeated saves do not add copies.
+  vector<string> linesOld;
+  ifstream is(initFile.c_str());
+  string line;
+  int nSkip = 0;
+  while ( getline(is, line) ) {
+    if (nSkip > 0) {--nSkip; continue;}
+    istringstream matchHeader(line);
+    string tag, keyIn, tag2;
+    matchHeader >> tag >> keyIn >> tag2 >> nSkip;
+    if (tag == "======key=" && keyIn == key && matchHeader) continue;
+    nSkip = 0;
+    linesOld.push_back(line);
+  }
+  is.close();
+
+  // Open file for writing, replacing the old contents.
+  const char* cstring = initFile.c_str();
+  ofstream os(cstring);
+  if (!os.good()) {
+    loggerPtr->ERROR_MSG("could not open file", initFile);
+    return false;
+  }
+
+  // Other setups, then the header for this setup, followed by one line
+  // per process.
+  for (const string& lineNow : linesOld) os << lineNow << endl;
+  os << "======key= " << key << " nData= " << lines.size() << " ====== "
+     << endl;
+  for (const string& lineNow : lines) os << lineNow << endl;
+
+  // Close file and done.
+  os.close();
+  return true;
+
+}
+
 //==========================================================================
 
 } // end namespace Pythia8
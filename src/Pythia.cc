@@ -13,6 +13,7 @@
 #include "Pythia8/StringInteractions.h"
 #include "Pythia8/Vincia.h"
 #include "Pythia8/Plugins.h"
+#include <chrono>
 
 namespace Pythia8 {
 
@@ -175,6 +176,44 @@ Pythia::Pythia( istream& settingsStrings, istream& particleDataStrings,
 
 //--------------------------------------------------------------------------
 
+// Constructor from a binary snapshot.
+
+Pythia::Pythia(const Snapshot& snapshot, bool printBanner) {
+
+  // Initialise / reset pointers and global variables.
+  initPtrs();
+
+  // Copy settings and particle databases from the snapshot.
+  settings.initPtrs(&logger);
+  particleData.initPtrs( &infoPrivate);
+  isConstructed = snapshot.load(settings, particleData);
+  if (!isConstructed) {
+    logger.ABORT_MSG("settings and particle data unavailable");
+    return;
+  }
+
+  // The environment variable takes precedence over the stored XML path.
+  const char* envPath = getenv("PYTHIA8DATA");
+  xmlPath = envPath ? envPath : "";
+  if (xmlPath.length() && xmlPath[xmlPath.length() - 1] != '/')
+    xmlPath += "/";
+  if (xmlPath.empty()) xmlPath = settings.word("xmlPath");
+  else settings.word("xmlPath", xmlPath);
+
+  // Check XML and header version numbers match code version number.
+  if (!checkVersion()) return;
+
+  // Write the Pythia banner to output.
+  if (printBanner) banner();
+
+  // Not initialized until at the end of the init() call.
+  isInit = false;
+  infoPrivate.addCounter(0);
+
+}
+
+//--------------------------------------------------------------------------
+
 // Initialise new Pythia object (common code called by constructors).
 
 void Pythia::initPtrs() {
@@ -519,6 +558,7 @@ bool Pythia::init() {
       return false;
     }
   }
+  hasHeavyIons = doHeavyIons;
 
   // Early readout, if return false or changed when no beams.
   doProcessLevel = flag("ProcessLevel:all");
@@ -540,9 +580,12 @@ bool Pythia::init() {
   // Initialize error printing settings.
   logger.init(settings);
 
-  // Initialize the random number generator.
-  if ( flag("Random:setSeed") ) rndm.init( mode("Random:seed") );
-  else                          rndm.init(Rndm::DEFAULTSEED);
+  // Initialize the random number generator, with the chosen engine.
+  int seedNow = flag("Random:setSeed") ? mode("Random:seed")
+    : Rndm::DEFAULTSEED;
+  if (mode("Random:engine") == 1) rndm.initCounter(seedNow);
+  else                            rndm.init(seedNow);
+  rndm.bufferExternal( flag("Random:bufferExternal") );
 
   // Count up number of initializations.
   infoPrivate.addCounter(1);
@@ -720,6 +763,20 @@ bool Pythia::init() {
   // Check that combinations of settings are allowed; change if not.
   checkSettings();
 
+  // Time spent in each of the main stages below. These are run one after
+  // the other, since each uses what the earlier ones set up: the resonance
+  // widths need the couplings, the hadron widths may rescale branching
+  // ratios in the particle data used by all later stages, the showers and
+  // beams are needed by the process level, and all of them by the parton
+  // and hadron levels.
+  initTimesSave.clear();
+  auto timeBegin = std::chrono::steady_clock::now();
+  auto endStage = [&](string name) {
+    auto timeNow = std::chrono::steady_clock::now();
+    initTimesSave.push_back( make_pair( name,
+      std::chrono::duration<double>(timeNow - timeBegin).count()));
+    timeBegin = timeNow; };
+
   // Initialize the SM couplings (needed to initialize resonances).
   coupSM.init( settings, &rndm );
 
@@ -736,9 +793,17 @@ bool Pythia::init() {
   int startColTag = mode("Event:startColTag");
   process.init("(hard process)", &particleData, startColTag);
   event.init("(complete event)", &particleData, startColTag);
+  endStage("couplings");
 
   // Final setup stage of particle data, notably resonance widths.
   particleData.initWidths( resonancePtrs);
+  endStage("resonanceWidths");
+
+  // Hash of the particle data, found once for the keys of the tables
+  // shared with other instances.
+  infoPrivate.sharedTablesKey = "";
+  if (infoPrivate.sharedTablesPtr)
+    infoPrivate.sharedTablesKey = hadronWidths.particleDataKey();
 
   // Read in files with particle widths.
   string dataFile = xmlPath + "HadronWidths.dat";
@@ -750,6 +815,7 @@ bool Pythia::init() {
     logger.ABORT_MSG("hadron widths are invalid");
     return false;
   }
+  endStage("hadronWidths");
 
   // Set up R-hadrons particle data, where relevant.
   rHadrons.init();
@@ -769,6 +835,7 @@ bool Pythia::init() {
   }
   sigmaLowEnergy.init( &nucleonExcitations);
   sigmaCmb.init( &sigmaLowEnergy);
+  endStage("nucleonExcitations");
 
   // Prepare for low-energy QCD processes.
   doNonPert = hadronLevel.initLowEnergyProcesses();
@@ -829,6 +896,8 @@ bool Pythia::init() {
     return false;
   }
 
+  endStage("showers");
+
   // Set up the beams.
   StringFlav* flavSelPtr = hadronLevel.getStringFlavPtr();
   if (!beamSetup.initBeams(doNonPert, flavSelPtr)) return false;
@@ -863,6 +932,8 @@ bool Pythia::init() {
     }
   }
 
+  endStage("beams");
+
   // Send info/pointers to process level for initialization.
   if ( doProcessLevel ) {
     sigmaTot.init();
@@ -890,6 +961,8 @@ bool Pythia::init() {
   // Alternatively only initialize resonance decays.
   if ( !doProcessLevel) processLevel.initDecays(lhaUpPtr);
 
+  endStage("processLevel");
+
   // Send info/pointers to parton level for initialization.
   if ( doPartonLevel && doProcessLevel && !partonLevel.init(timesDecPtr,
     timesPtr, spacePtr, &rHadrons, mergingHooksPtr,
@@ -927,6 +1000,8 @@ bool Pythia::init() {
     mergingPtr->init();
   }
 
+  endStage("partonLevel");
+
   // Send info/pointers to hadron level for initialization.
   // Note: forceHadronLevel() can come, so we must always initialize.
   if ( !hadronLevel.init( timesDecPtr, &rHadrons, decayHandlePtr,
@@ -935,6 +1010,29 @@ bool Pythia::init() {
     logger.ABORT_MSG("hadronLevel initialization failed");
     return false;
   }
+  endStage("hadronLevel");
+
+  // Optionally print the time spent in each stage.
+  if (flag("Init:showTiming")) {
+    std::ios_base::fmtflags flagsSave = cout.flags();
+    std::streamsize precisionSave = cout.precision();
+    cout << "\n *-------  PYTHIA Initialization Timing  ----------------"
+         << "-----------* \n |                                               "
+         << "                   | \n";
+    double timeSum = 0.;
+    for (auto& stage : initTimesSave) {
+      cout << " |  " << left << setw(45) << stage.first << right << fixed
+           << setprecision(3) << setw(12) << stage.second << " s     | \n";
+      timeSum += stage.second;
+    }
+    cout << " |  " << left << setw(45) << "sum" << right << fixed
+         << setprecision(3) << setw(12) << timeSum << " s     | \n"
+         << " |                                                          "
+         << "        | \n *-------  End PYTHIA Initialization Timing  ------"
+         << "-----------------* " << endl;
+    cout.flags(flagsSave);
+    cout.precision(precisionSave);
+  }
 
   // Optionally check particle data table for inconsistencies.
   if ( flag("Check:particleData") )
@@ -1032,6 +1130,10 @@ bool Pythia::next(int procType) {
     return false;
   }
 
+  // With a counter-based random number engine, start the sequence of
+  // the next event. Not when called back from the HeavyIons object.
+  if (doHeavyIons || !hasHeavyIons) rndm.nextEvent();
+
   // Flexible-use call at the beginning of each new event.
   beginEvent();
 
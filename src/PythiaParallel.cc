@@ -7,11 +7,90 @@
 // PythiaParallel class.
 
 #include "Pythia8/PythiaParallel.h"
+#include <chrono>
 
 namespace Pythia8 {
 
 //==========================================================================
 
+// The EventBuffer class.
+
+//--------------------------------------------------------------------------
+
+// Constructor. At least two slots are needed, since with a single slot
+// a filled slot would look free to the next producer.
+
+EventBuffer::EventBuffer(int sizeIn) : slots(), mask(), writePos(0),
+  padding(), readPos(0) {
+  long nSlots = 2;
+  while (nSlots < sizeIn) nSlots *= 2;
+  slots = vector<Slot>(nSlots);
+  mask  = nSlots - 1;
+  for (long i = 0; i < nSlots; ++i)
+    slots[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------------
+
+// Claim a free slot for writing. A slot is free when its sequence number
+// equals the write position.
+
+EventSnapshot* EventBuffer::tryClaimWrite(long& ticket) {
+  long pos = writePos.load(std::memory_order_relaxed);
+  while (true) {
+    Slot& slot = slots[pos & mask];
+    long diff = slot.sequence.load(std::memory_order_acquire) - pos;
+    if (diff == 0) {
+      if (writePos.compare_exchange_weak(pos, pos + 1,
+        std::memory_order_relaxed)) {
+        ticket = pos;
+        return &slot.snapshot;
+      }
+    } else if (diff < 0) return nullptr;
+    else pos = writePos.load(std::memory_order_relaxed);
+  }
+}
+
+//--------------------------------------------------------------------------
+
+// Mark a written slot as ready to be read.
+
+void EventBuffer::commitWrite(long ticket) {
+  slots[ticket & mask].sequence.store(ticket + 1, std::memory_order_release);
+}
+
+//--------------------------------------------------------------------------
+
+// Claim the oldest ready slot for reading. A slot is ready when its
+// sequence number is one above the read position.
+
+EventSnapshot* EventBuffer::tryClaimRead(long& ticket) {
+  long pos = readPos.load(std::memory_order_relaxed);
+  while (true) {
+    Slot& slot = slots[pos & mask];
+    long diff = slot.sequence.load(std::memory_order_acquire) - (pos + 1);
+    if (diff == 0) {
+      if (readPos.compare_exchange_weak(pos, pos + 1,
+        std::memory_order_relaxed)) {
+        ticket = pos;
+        return &slot.snapshot;
+      }
+    } else if (diff < 0) return nullptr;
+    else pos = readPos.load(std::memory_order_relaxed);
+  }
+}
+
+//--------------------------------------------------------------------------
+
+// Mark a read slot as free, for the write one lap further on.
+
+void EventBuffer::commitRead(long ticket) {
+  slots[ticket & mask].sequence.store(ticket + mask + 1,
+    std::memory_order_release);
+}
+
+//==========================================================================
+
 // The PythiaParallel class.
 
 //--------------------------------------------------------------------------
@@ -81,14 +160,23 @@ bool PythiaParallel::init(function<bool(Pythia*)> customInit) {
   }
   processAsync = settings.flag("Parallelism:processAsync");
   balanceLoad  = settings.flag("Parallelism:balanceLoad");
+  workStealing = settings.flag("Parallelism:workStealing");
   doNext       = settings.flag("Parallelism:doNext");
+  chunkSize    = settings.mode("Parallelism:chunkSize");
+  bufferSize   = settings.mode("Parallelism:bufferSize");
+  numConsumers = settings.mode("Parallelism:numConsumers");
+  bufferWait   = settings.mode("Parallelism:bufferWait");
+  shareTables  = settings.flag("Parallelism:shareTables");
+  counterRndm  = settings.mode("Random:engine") == 1;
+  nEventsRun   = 0;
 
   if (!doNext && !processAsync) {
     logger.WARNING_MSG(
       "setting both doNext and processAsync to off prevents parallelism");
   }
 
-  // Set seeds.
+  // Set seeds. With a counter-based random number engine all objects
+  // use the same seed, and events are instead told apart by their number.
   vector<int> seeds = settings.mvec("Parallelism:seeds");
   if (seeds.size() == 0) {
     seeds = vector<int>(numThreads);
@@ -98,35 +186,103 @@ bool PythiaParallel::init(function<bool(Pythia*)> customInit) {
     else if (seed0 == 0)
       seed0 = int(time(0));
     for (int i = 0; i < numThreads; ++i)
-      seeds[i] = seed0 + i;
+      seeds[i] = counterRndm ? seed0 : seed0 + i;
     settings.mvec("Parallelism:seeds", seeds);
   }
 
+  // Store of read-only tables shared between the instances, if any.
+  sharedTablesPtr = shareTables ? make_shared<SharedTables>() : nullptr;
+
+  // With a Les Houches Event File, one reader hands out the events.
+  lhefDispatcherPtr = nullptr;
+  string lhef = settings.word("Beams:LHEF");
+  int nSkipLHEF = settings.mode("Beams:nSkipLHEFatInit");
+  if (settings.mode("Beams:frameType") == 4
+    && settings.flag("Parallelism:shareLHEF")) {
+    if (settings.word("Beams:LHEFheader") != "void")
+      logger.WARNING_MSG("cannot share reader with separate LHEF header");
+    else {
+      lhefDispatcherPtr = make_shared<LHEFDispatcher>(lhef,
+        settings.mode("Parallelism:lhefBufferSize"), nSkipLHEF);
+      if (!lhefDispatcherPtr->init()) {
+        logger.ABORT_MSG("Les Houches Event File not found", lhef);
+        return false;
+      }
+    }
+  }
+
   // Create instances in parallel.
   pythiaObjects = vector<unique_ptr<Pythia>>(numThreads);
+  useSharedLHEF = vector<int>(numThreads, 0);
 
   vector<thread> initThreads;
-  bool initSuccess = true;
-
-  for (int iPythia = 0; iPythia < numThreads; iPythia += 1) {
-    initThreads.emplace_back([=, &seeds, &initSuccess]() {
-      Pythia* pythiaPtr = new Pythia(settings, particleData, false);
-      pythiaObjects[iPythia] = unique_ptr<Pythia>(pythiaPtr);
-      pythiaObjects[iPythia]->settings.flag("Print:quiet", true);
-      pythiaObjects[iPythia]->settings.flag("Random:setSeed", true);
-      pythiaObjects[iPythia]->settings.mode("Random:seed", seeds[iPythia]);
-      pythiaObjects[iPythia]->settings.mode("Parallelism:index", iPythia);
-
-      if (customInit && !customInit(pythiaObjects[iPythia].get()))
-        initSuccess = false;
-      if (!pythiaObjects[iPythia]->init())
-        initSuccess = false;
-    });
+  atomic<bool> initSuccess(true);
+
+  auto initInstance = [=, &seeds, &initSuccess](int iPythia) {
+    Pythia* pythiaPtr = new Pythia(settings, particleData, false);
+    pythiaObjects[iPythia] = unique_ptr<Pythia>(pythiaPtr);
+    pythiaObjects[iPythia]->settings.flag("Print:quiet", true);
+    pythiaObjects[iPythia]->settings.flag("Random:setSeed", true);
+    pythiaObjects[iPythia]->settings.mode("Random:seed", seeds[iPythia]);
+    pythiaObjects[iPythia]->settings.mode("Parallelism:index", iPythia);
+    if (sharedTablesPtr)
+      pythiaObjects[iPythia]->setSharedTablesPtr(sharedTablesPtr);
+
+    if (customInit && !customInit(pythiaObjects[iPythia].get()))
+      initSuccess = false;
+
+    // Use the shared reader only if customInit did not change the input,
+    // else let the instance read its own file.
+    Settings& settingsNow = pythiaObjects[iPythia]->settings;
+    if (lhefDispatcherPtr && settingsNow.mode("Beams:frameType") == 4) {
+      if (settingsNow.word("Beams:LHEF") == lhef
+        && settingsNow.word("Beams:LHEFheader") == "void"
+        && settingsNow.mode("Beams:nSkipLHEFatInit") == nSkipLHEF) {
+        settingsNow.mode("Beams:nSkipLHEFatInit", 0);
+        pythiaObjects[iPythia]->setLHEFDispatcherPtr(lhefDispatcherPtr);
+        useSharedLHEF[iPythia] = 1;
+      } else useSharedLHEF[iPythia] = -1;
+    }
+
+    if (!pythiaObjects[iPythia]->init())
+      initSuccess = false;
+  };
+
+  // With shared tables, the first instance is initialized on its own,
+  // so that the others can reuse the tables it has set up.
+  int iFirstParallel = 0;
+  if (sharedTablesPtr) {
+    initInstance(0);
+    iFirstParallel = 1;
   }
 
+  for (int iPythia = iFirstParallel; iPythia < numThreads; iPythia += 1)
+    initThreads.emplace_back(initInstance, iPythia);
+
   // Wait for all initialization threads to finish.
-  for (int i = 0; i < numThreads; ++i)
-    initThreads[i].join();
+  for (thread& initThread : initThreads)
+    initThread.join();
+
+  // The cross sections of instances that share the Les Houches Event File
+  // and of those that read their own cannot be combined, so refuse a mix.
+  int nSharedLHEF = std::count(useSharedLHEF.begin(), useSharedLHEF.end(), 1);
+  if (nSharedLHEF > 0 && nSharedLHEF < numThreads) {
+    logger.ABORT_MSG("customInit changed Les Houches Event File input for "
+      "some instances only; use Parallelism:shareLHEF = off");
+    return false;
+  }
+  for (int iPythia = 0; iPythia < numThreads; ++iPythia)
+    if (useSharedLHEF[iPythia] == -1) {
+      logger.WARNING_MSG("customInit changed Les Houches Event File input,"
+        " so instance reads it on its own",
+        pythiaObjects[iPythia]->settings.word("Beams:LHEF"));
+      useSharedLHEF[iPythia] = 0;
+    }
+  if (nSharedLHEF == 0) lhefDispatcherPtr = nullptr;
+  if (sharedTablesPtr)
+    logger.INFO_MSG("number of shared tables set up / reused",
+      to_string(sharedTablesPtr->nCreated()) + " / "
+      + to_string(sharedTablesPtr->nReused()));
 
   // Set initialization.
   if (!initSuccess) {
@@ -165,27 +321,69 @@ vector<long> PythiaParallel::run(long nEvents,
   atomic<long> nFinishedEvents(0);
   vector<thread> threads;
 
+  // For work stealing, split the events into contiguous index ranges,
+  // one per thread, which are then handed out in chunks.
+  vector<EventRange> ranges(workStealing ? numThreadsNow : 0);
+  long nChunk = chunkSize;
+  if (workStealing) {
+    if (nChunk <= 0) nChunk = max( 1L, nEvents / (16L * numThreadsNow));
+    for (int iThread = 0; iThread < numThreadsNow; ++iThread) {
+      ranges[iThread].iBegin = nEvents * iThread / numThreadsNow;
+      ranges[iThread].iEnd   = nEvents * (iThread + 1) / numThreadsNow;
+    }
+  }
+
+  // Keep track of busy time for each thread.
+  busyTimeSave = vector<double>(numThreadsNow, 0.);
+  idleTimeSave = vector<double>(numThreadsNow, 0.);
+  auto runStart = std::chrono::steady_clock::now();
+
   // Define the thread main that will run for each Pythia object.
   auto threadMain = [&, this, callback](Pythia* pythiaPtr, int iPythia) {
 
     // If load is balanced, we need the number of events to run on this thread.
     long nLocalEvents = nEvents / numThreadsNow;
-    if (iPythia < nEvents - (nLocalEvents * numThreadsNow))
-      nLocalEvents += 1;
+    long nRemainder   = nEvents - (nLocalEvents * numThreadsNow);
+    if (iPythia < nRemainder) nLocalEvents += 1;
+
+    // Index of the current event in the run, which also numbers the random
+    // sequences for a counter-based engine, and the next one to be taken
+    // when load is balanced.
+    long iEvent = 0;
+    long iLocalEvent = (nEvents / numThreadsNow) * iPythia
+      + min( long(iPythia), nRemainder);
+
+    // Current chunk of events when work stealing.
+    long iChunk = 0, iChunkEnd = 0;
 
     // Run the Pythia object.
     while (true) {
 
-      // Check if we're done, depending on whether load should be balanced.
-      if (balanceLoad) {
+      // Check if we're done, depending on the scheduling strategy.
+      if (workStealing) {
+        if (iChunk == iChunkEnd
+          && !nextChunk(ranges, iPythia, nChunk, iChunk, iChunkEnd)) break;
+        iEvent = iChunk++;
+      }
+      else if (balanceLoad) {
         if (nLocalEvents == 0) break;
         nLocalEvents -= 1;
+        iEvent = iLocalEvent++;
       }
-      else if (nStartedEvents++ >= nEvents) break;
+      else if ((iEvent = nStartedEvents++) >= nEvents) break;
 
       // Generate the event.
+      if (counterRndm) pythiaPtr->rndm.setNextEvent(nEventsRun + iEvent);
+      auto eventStart = std::chrono::steady_clock::now();
       bool success = !doNext || pythiaPtr->next();
 
+      // Stop when the end of a Les Houches Event File has been reached.
+      if (!success && pythiaPtr->info.atEndOfFile()) {
+        busyTimeSave[iPythia] += std::chrono::duration<double>(
+          std::chrono::steady_clock::now() - eventStart).count();
+        break;
+      }
+
       // Increment counter for number of generated events.
       // Note the use of printf for thread safety.
       eventsPerThread[iPythia] += 1;
@@ -195,16 +393,22 @@ vector<long> PythiaParallel::run(long nEvents,
         printf("\n PythiaParallel::run(): %ld events have been generated\n",
           generatedEventsNow);
 
-      // Pass the generated event to the callback.
+      // Pass the generated event to the callback. Waiting for the lock
+      // is counted as idle time.
       if (success) {
         if (processAsync) {
           callback(pythiaPtr);
         } else {
+          busyTimeSave[iPythia] += std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - eventStart).count();
           // Lock access to the callback.
           const std::lock_guard<mutex> lock(callbackMutex);
+          eventStart = std::chrono::steady_clock::now();
           callback(pythiaPtr);
         }
       }
+      busyTimeSave[iPythia] += std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - eventStart).count();
     }
   }; // end thread main
 
@@ -215,6 +419,7 @@ vector<long> PythiaParallel::run(long nEvents,
   // Zero the counters.
   weightSumSave = 0.;
   sigmaGenSave = 0.;
+  double sigmaWeightSum = 0.;
 
   // Wait for each thread to finish.
   for (int iPythia = 0; iPythia < numThreadsNow; ++iPythia) {
@@ -223,17 +428,170 @@ vector<long> PythiaParallel::run(long nEvents,
 
     double weightSumNow = pythiaObjects[iPythia]->info.weightSum();
     weightSumSave += weightSumNow;
-    sigmaGenSave  += weightSumNow * pythiaObjects[iPythia]->info.sigmaGen();
+
+    // With a shared Les Houches Event File each instance has estimated the
+    // cross section from its own share of the events, so combine the
+    // estimates by the number of events tried. Either all instances share
+    // the file or none does.
+    double sigmaWeight = (useSharedLHEF[iPythia])
+      ? double(pythiaObjects[iPythia]->info.nTried()) : weightSumNow;
+    sigmaWeightSum += sigmaWeight;
+    sigmaGenSave   += sigmaWeight * pythiaObjects[iPythia]->info.sigmaGen();
   }
 
+  // Idle time is the remainder of the total wall time of the run.
+  double runTime = std::chrono::duration<double>(
+    std::chrono::steady_clock::now() - runStart).count();
+  for (int iPythia = 0; iPythia < numThreadsNow; ++iPythia)
+    idleTimeSave[iPythia] = max( 0., runTime - busyTimeSave[iPythia]);
+
+  // Later runs continue the event numbering.
+  nEventsRun += nEvents;
+
   // Set generated cross section and return.
-  sigmaGenSave /= weightSumSave;
+  sigmaGenSave /= sigmaWeightSum;
   return eventsPerThread;
 
 }
 
 //--------------------------------------------------------------------------
 
+// Run Pythia objects, with events passed through a buffer to consumers.
+
+vector<long> PythiaParallel::runBuffered(long nEvents,
+  function<void(const EventSnapshot&)> consumer) {
+
+  if (!isInit) {
+    logger.ABORT_MSG("not initialized");
+    return vector<long>();
+  }
+
+  // Wait while the buffer is full or empty, by yielding or sleeping.
+  auto wait = [this]() {
+    if (bufferWait == 0) std::this_thread::yield();
+    else std::this_thread::sleep_for(std::chrono::microseconds(bufferWait));
+  };
+
+  // Start the consumers, which run until the producers are done and
+  // the buffer has been drained.
+  EventBuffer buffer(bufferSize);
+  atomic<bool> producersDone(false);
+  vector<thread> consumers;
+  for (int iConsumer = 0; iConsumer < numConsumers; ++iConsumer)
+    consumers.emplace_back([&]() {
+      while (true) {
+        bool doneBefore = producersDone.load(std::memory_order_acquire);
+        long ticket;
+        EventSnapshot* snapshotPtr = buffer.tryClaimRead(ticket);
+        if (snapshotPtr == nullptr) {
+          if (doneBefore) break;
+          wait();
+          continue;
+        }
+        consumer(*snapshotPtr);
+        buffer.commitRead(ticket);
+      }
+    });
+
+  // Index of each instance, looked up once rather than for every event.
+  map<const Pythia*, int> indexOf;
+  for (auto& pythiaNow : pythiaObjects)
+    indexOf[pythiaNow.get()] = pythiaNow->settings.mode("Parallelism:index");
+
+  // Producers copy the event into a free slot and go on generating.
+  auto producer = [&](Pythia* pythiaPtr) {
+    long ticket;
+    EventSnapshot* snapshotPtr;
+    while ((snapshotPtr = buffer.tryClaimWrite(ticket)) == nullptr) wait();
+    snapshotPtr->event    = pythiaPtr->event;
+    snapshotPtr->process  = pythiaPtr->process;
+    int nWeights = pythiaPtr->info.numberOfWeights();
+    snapshotPtr->weights.resize(nWeights);
+    for (int iWeight = 0; iWeight < nWeights; ++iWeight)
+      snapshotPtr->weights[iWeight]
+        = pythiaPtr->info.weightValueByIndex(iWeight);
+    snapshotPtr->sigmaGen = pythiaPtr->info.sigmaGen();
+    snapshotPtr->sigmaErr = pythiaPtr->info.sigmaErr();
+    snapshotPtr->iPythia  = indexOf.at(pythiaPtr);
+    buffer.commitWrite(ticket);
+  };
+
+  // The producers need no synchronization among themselves.
+  bool processAsyncSave = processAsync;
+  processAsync = true;
+  vector<long> eventsPerThread = run(nEvents, producer);
+  processAsync = processAsyncSave;
+
+  // Let the consumers drain the buffer and finish.
+  producersDone.store(true, std::memory_order_release);
+  for (thread& consumerNow : consumers) consumerNow.join();
+  return eventsPerThread;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Take the next chunk of events for a thread. Chunks are taken from the
+// front of the range owned by the thread. When it is empty, half of the
+// remaining range of the thread with most work left is stolen.
+
+bool PythiaParallel::nextChunk(vector<EventRange>& ranges, int iThread,
+  long nChunk, long& iBeginChunk, long& iEndChunk) {
+
+  // Try the range owned by this thread first.
+  EventRange& own = ranges[iThread];
+  {
+    lock_guard<mutex> lock(own.rangeMutex);
+    if (own.iBegin < own.iEnd) {
+      iBeginChunk = own.iBegin;
+      iEndChunk   = min(own.iEnd, own.iBegin + nChunk);
+      own.iBegin  = iEndChunk;
+      return true;
+    }
+  }
+
+  // Otherwise steal from other threads, until no work is left anywhere.
+  int nThreads = ranges.size();
+  while (true) {
+
+    // Find the victim with the most remaining events. The range may
+    // shrink before it is locked again below, so check it then.
+    int iVictim = -1;
+    long nMost = 0;
+    for (int iOther = 0; iOther < nThreads; ++iOther) {
+      if (iOther == iThread) continue;
+      lock_guard<mutex> lock(ranges[iOther].rangeMutex);
+      long nLeft = ranges[iOther].iEnd - ranges[iOther].iBegin;
+      if (nLeft > nMost) {
+        nMost   = nLeft;
+        iVictim = iOther;
+      }
+    }
+    if (iVictim < 0) return false;
+
+    // Steal the back half of the victim range, and keep one chunk of it.
+    long iStealBegin, iStealEnd;
+    {
+      EventRange& victim = ranges[iVictim];
+      lock_guard<mutex> lock(victim.rangeMutex);
+      long nLeft = victim.iEnd - victim.iBegin;
+      if (nLeft <= 0) continue;
+      iStealEnd    = victim.iEnd;
+      iStealBegin  = victim.iEnd - (nLeft + 1) / 2;
+      victim.iEnd  = iStealBegin;
+    }
+    iBeginChunk = iStealBegin;
+    iEndChunk   = min(iStealEnd, iStealBegin + nChunk);
+    lock_guard<mutex> lock(own.rangeMutex);
+    own.iBegin = iEndChunk;
+    own.iEnd   = iStealEnd;
+    return true;
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Perform the specified action for each Pythia instance.
 
 void PythiaParallel::foreach(function<void(Pythia*)> action) {
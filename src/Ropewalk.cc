@@ -404,9 +404,10 @@ pair<int, int> RopeDipole::getOverlaps(double yfrac, double m0, double r0) {
   double yL = d1.rap(m0,rotTo);
   double yS = d2.rap(m0,rotTo);
   double yH = yS + (yL - yS) * yfrac;
+  Vec4 bH = bInterpolateDip(yH,m0);
   int m = 0, n = 0;
   for (size_t i = 0; i < overlaps.size(); ++i) {
-    if (overlaps[i].overlap( yfrac, bInterpolateDip(yH,m0), r0)
+    if (overlaps[i].overlap( yfrac, bH, r0)
       && !overlaps[i].hadronized()) {
         if (overlaps[i].dir > 0) ++m;
         else                     ++n;
@@ -520,6 +521,8 @@ bool Ropewalk::init() {
   tInit                = parm("Ropewalk:tInit");
   showerCut            = parm("TimeShower:pTmin");
   alwaysHighest        = flag("Ropewalk:alwaysHighest");
+  useGrid              = flag("Ropewalk:useGrid");
+  nThreads             = threadCount(mode("Ropewalk:numThreads"));
 
   // Creat the interface objects.
   if ( flag("Ropewalk:doShoving") ) {
@@ -620,26 +623,32 @@ double Ropewalk::getKappaHere(int e1, int e2, double yfrac) {
 
 bool Ropewalk::calculateOverlaps() {
 
-  // Go through all dipoles.
-  for (multimap< pair<int,int>, RopeDipole>::iterator itr = dipoles.begin();
-    itr != dipoles.end(); ++itr ) {
-    RopeDipole* d1 = &(itr->second);
-    if (d1->dipoleMomentum().m2Calc() < pow2(m0)) continue;
+  // Collect the dipoles which are not too small to overlap.
+  vector<RopeDipole*> dips;
+  for (DMap::iterator itr = dipoles.begin(); itr != dipoles.end(); ++itr)
+    if (itr->second.dipoleMomentum().m2Calc() >= pow2(m0))
+      dips.push_back(&(itr->second));
+  int nDip = dips.size();
+
+  // Go through all dipoles. Each one only changes its own list of overlaps,
+  // so they may be shared among several threads.
+  parallelFor(nDip, nThreads, [&](int, int i) {
+    RopeDipole* d1 = dips[i];
 
     // RopeDipoles rapidities in dipole rest frame.
     RotBstMatrix dipoleRestFrame = d1->getDipoleRestFrame();
     double yc1 = d1->d1Ptr()->rap(m0, dipoleRestFrame);
     double ya1 = d1->d2Ptr()->rap(m0, dipoleRestFrame);
-    if (yc1 <= ya1) continue;
+    if (yc1 <= ya1) return;
 
-    // Go through all possible overlapping dipoles.
-    for (multimap< pair<int,int>, RopeDipole>::iterator itr2 = dipoles.begin();
-      itr2 != dipoles.end(); ++itr2) {
-      RopeDipole* d2 = &(itr2->second);
+    // Go through all possible overlapping dipoles. The transverse
+    // distance is only checked later, in the rest frame of d1, so there
+    // is no cheap lab-frame selection of candidates.
+    for (int j = 0; j < nDip; ++j) {
+      RopeDipole* d2 = dips[j];
 
-      // Skip self and overlaps with miniscule dipoles.
+      // Skip self.
       if (d1 == d2) continue;
-      if (d2->dipoleMomentum().m2Calc() < pow2(m0)) continue;
 
       // Ignore if not overlapping in rapidity.
       OverlappingRopeDipole od(d2, m0, dipoleRestFrame);
@@ -649,10 +658,11 @@ bool Ropewalk::calculateOverlaps() {
       d1->addOverlappingDipole(od);
 
     }
-  }
+  });
   return true;
 
 }
+
 //--------------------------------------------------------------------------
 
 // Invoke the random walk of colour states.
@@ -733,6 +743,8 @@ void Ropewalk::shoveTheDipoles(Event& event) {
 
   // For each value of ySample, we have a vector of excitation pairs.
   map<double, vector<Exc> > exPairs;
+  // With the grid, the sampled dipoles of each slice are kept instead.
+  vector< vector<RopeDipole*> > sliceDipoles;
   for (int i = 0, N = eParticles.size(); i < N; ++i) eParticles[i].clear();
   eParticles.clear();
   for (int i = 0, N = rapidities.size(); i < N; ++i) {
@@ -772,6 +784,11 @@ void Ropewalk::shoveTheDipoles(Event& event) {
       pp.vProd( tmp[j]->bInterpolateLab(ySample,m0) * FM2MM);
       eParticles[i].push_back(pp);
     }
+  // With the grid, pairs are only formed when they are close enough.
+  if (useGrid) {
+    sliceDipoles.push_back(tmp);
+    continue;
+  }
   // Construct all pairs of possible excitations in this slice.
   exPairs[ySample] = vector<Exc>();
   for (int j = 0, M = tmp.size(); j < M; ++j)
@@ -792,33 +809,77 @@ void Ropewalk::shoveTheDipoles(Event& event) {
     }
   }
 
+  // With the grid, give each sampled dipole its excitation, if there is
+  // another string in the slice that it can form a pair with.
+  for (int i = 0, N = sliceDipoles.size(); i < N; ++i) {
+    const vector<RopeDipole*>& dips = sliceDipoles[i];
+    for (int j = 0, M = dips.size(); j < M; ++j)
+      for (int k = 0; k < M; ++k)
+        if (dips[k]->index() != dips[j]->index()) {
+          dips[j]->addExcitation(rapidities[i], &eParticles[i][j]);
+          break;
+        }
+  }
+
+  // With the grid, the dipole rest frames are found before the shoving
+  // starts, rather than when first needed, so that they are not changed
+  // while the pushes are found in parallel.
+  if (useGrid)
+    for (int i = 0, N = sliceDipoles.size(); i < N; ++i)
+      for (RopeDipole* dip : sliceDipoles[i]) dip->getDipoleRestFrame();
+
   // Shoving loop.
   for (double t = tInit; t < tShove + tInit; t += deltat) {
-    // For all slices.
-    for (map<double, vector<Exc> >::iterator slItr = exPairs.begin();
-      slItr != exPairs.end(); ++slItr)
-      // For all excitation pairs.
-      for (int i = 0, N = slItr->second.size(); i < N; ++i) {
-        Exc& ep = slItr->second[i];
-        // The direction vector is a space-time four-vector.
-        Vec4 direction = ep.direction();
-        // The string radius is time dependent,
-        // growing with the speed of light.
-        // Minimal string size is 1 / shower cut-off
-        // converted to fm.
-        double rt = max(t, 1. / showerCut / 5.068);
-        rt = min(rt, r0 * gExponent);
-        double dist = direction.pT();
-        // Calculate the push, its direction and do the shoving.
-        if (dist < rCutOff * rt) {
-          // Gain function.
-          double gain = 0.5 * deltay * deltat * gAmplitude * dist / rt / rt
-                      * exp( -0.25 * dist * dist / rt / rt);
-          double dpx = dist > 0.0 ? gain * direction.px() / dist: 0.0;
-          double dpy = dist > 0.0 ? gain * direction.py() / dist: 0.0;
-          ep.shove(dpx, dpy);
+
+    // With the grid, all pushes of the time step are found from the
+    // excitation positions at its start, with the slices possibly shared
+    // among several threads. They are then applied here, slice by slice
+    // and in the same order of pairs as below, since whether a dipole can
+    // take the recoil of a push depends on the pushes applied before.
+    if (useGrid) {
+      double rt = max(t, 1. / showerCut / 5.068);
+      rt = min(rt, r0 * gExponent);
+      int nSlice = sliceDipoles.size();
+      vector< vector<RopePush> > pushes(nSlice);
+      parallelFor(nSlice, nThreads, [&](int, int i) {
+        slicePushes(rapidities[i], sliceDipoles[i], rt, pushes[i]); });
+      for (int i = 0; i < nSlice; ++i)
+        for (const RopePush& push : pushes[i]) {
+          Exc ep(rapidities[i], m0, i, push.j, push.k,
+            sliceDipoles[i][push.j], sliceDipoles[i][push.k]);
+          ep.pp1 = &eParticles[i][push.j];
+          ep.pp2 = &eParticles[i][push.k];
+          ep.shove(push.dpx, push.dpy);
         }
-      }
+    }
+
+    // Otherwise, for all slices.
+    else {
+      for (map<double, vector<Exc> >::iterator slItr = exPairs.begin();
+        slItr != exPairs.end(); ++slItr)
+        // For all excitation pairs.
+        for (int i = 0, N = slItr->second.size(); i < N; ++i) {
+          Exc& ep = slItr->second[i];
+          // The direction vector is a space-time four-vector.
+          Vec4 direction = ep.direction();
+          // The string radius is time dependent,
+          // growing with the speed of light.
+          // Minimal string size is 1 / shower cut-off
+          // converted to fm.
+          double rt = max(t, 1. / showerCut / 5.068);
+          rt = min(rt, r0 * gExponent);
+          double dist = direction.pT();
+          // Calculate the push, its direction and do the shoving.
+          if (dist < rCutOff * rt) {
+            // Gain function.
+            double gain = 0.5 * deltay * deltat * gAmplitude * dist / rt / rt
+                        * exp( -0.25 * dist * dist / rt / rt);
+            double dpx = dist > 0.0 ? gain * direction.px() / dist: 0.0;
+            double dpy = dist > 0.0 ? gain * direction.py() / dist: 0.0;
+            ep.shove(dpx, dpy);
+          }
+        }
+    }
 
     // Propagate the dipoles.
     for (DMap::iterator dItr = dipoles.begin(); dItr != dipoles.end(); ++dItr)
@@ -834,6 +895,73 @@ void Ropewalk::shoveTheDipoles(Event& event) {
 
 //--------------------------------------------------------------------------
 
+// Find the pushes between the excitation pairs of a rapidity slice, from
+// the positions of the excitations. These are sorted into cells of the
+// transverse plane, no smaller than the cut-off radius, so that only
+// pairs in neighbouring cells need be compared. The pushes are given in
+// the same order of pairs as when all pairs are compared.
+
+void Ropewalk::slicePushes(double y, const vector<RopeDipole*>& dips,
+  double rt, vector<RopePush>& pushes) {
+
+  int nDip = dips.size();
+  double rMax = rCutOff * rt;
+  if (nDip < 2 || !(rMax > 0.)) return;
+
+  // Place each excitation in its cell, unless its position is not finite,
+  // in which case it is not shoved. Distant positions share the outermost
+  // cells.
+  vector<Vec4> pos(nDip);
+  vector< pair<int, int> > cellOf(nDip);
+  vector<bool> inCell(nDip, false);
+  map<pair<int, int>, vector<int> > cells;
+  for (int j = 0; j < nDip; ++j) {
+    pos[j] = dips[j]->bInterpolateDip(y, m0);
+    inCell[j] = isfinite(pos[j].px()) && isfinite(pos[j].py());
+    if (!inCell[j]) continue;
+    cellOf[j] = make_pair(
+      int(max(-1e9, min(1e9, floor(pos[j].px() / rMax)))),
+      int(max(-1e9, min(1e9, floor(pos[j].py() / rMax)))) );
+    cells[cellOf[j]].push_back(j);
+  }
+
+  // For each excitation, find the others that are close enough, in order.
+  vector<int> near;
+  for (int j = 0; j < nDip; ++j) {
+    if (!inCell[j]) continue;
+    near.clear();
+    for (int ix = cellOf[j].first - 1; ix <= cellOf[j].first + 1; ++ix)
+    for (int iy = cellOf[j].second - 1; iy <= cellOf[j].second + 1; ++iy) {
+      map<pair<int, int>, vector<int> >::iterator cItr
+        = cells.find(make_pair(ix, iy));
+      if (cItr == cells.end()) continue;
+      for (int k : cItr->second)
+        // Don't allow a string to shove itself.
+        if (k != j && dips[k]->index() != dips[j]->index()
+          && (pos[j] - pos[k]).pT() < rMax) near.push_back(k);
+    }
+    sort(near.begin(), near.end());
+
+    // Calculate the push, and its direction.
+    for (int k : near) {
+      Vec4 direction = pos[j] - pos[k];
+      double dist = direction.pT();
+      // Gain function.
+      double gain = 0.5 * deltay * deltat * gAmplitude * dist / rt / rt
+                  * exp( -0.25 * dist * dist / rt / rt);
+      RopePush push;
+      push.j   = j;
+      push.k   = k;
+      push.dpx = dist > 0.0 ? gain * direction.px() / dist: 0.0;
+      push.dpy = dist > 0.0 ? gain * direction.py() / dist: 0.0;
+      pushes.push_back(push);
+    }
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
 // Extract all dipoles from an event.
 
 bool Ropewalk::extractDipoles(Event& event, ColConfig& colConfig) {
@@ -899,6 +1027,10 @@ const double RopeFragPars::ACONV = 0.001;
 // Low z cut-off in fragmentation function.
 const double RopeFragPars::ZCUT = 1.0e-4;
 
+// Step size in h of the table of parameters, and maximum h tabulated.
+const double RopeFragPars::DHTABLE = 0.05;
+const double RopeFragPars::HTABLEMAX = 100.;
+
 //--------------------------------------------------------------------------
 
 // The init function sets up initial parameters from settings.
@@ -918,6 +1050,20 @@ bool RopeFragPars::init() {
     &yIn, &xiIn, &kappaIn};
   for (int i = 0; i < len; ++i) *variables[i] = parm(params[i]);
 
+  // Restart caches, and optionally use a table, with nodes from h = 1 up
+  // to HTABLEMAX that are only calculated when first needed.
+  parameters.clear();
+  aMap.clear();
+  aDiqMap.clear();
+  table.clear();
+  hasNode.clear();
+  doTable = flag("Ropewalk:tabulateParameters");
+  if (doTable) {
+    int nNode = int( (HTABLEMAX - 1.0) / DHTABLE + 0.5) + 1;
+    table.resize(nNode);
+    hasNode.resize(nNode, false);
+  }
+
   // Insert the h = 1 case immediately.
   sigmaEff = sigmaIn, aEff = aIn, adiqEff = adiqIn, bEff = bIn,
     rhoEff = rhoIn, xEff = xIn, yEff = yIn, xiEff = xiIn, kappaEff = kappaIn;
@@ -932,12 +1078,35 @@ bool RopeFragPars::init() {
 
 //--------------------------------------------------------------------------
 
-// Return parameters at given string tension, ordered by their
-// name for easy insertion in settings.
-
-map<string,double> RopeFragPars::getEffectiveParameters(double h) {
+// Return parameters at given string tension. Interpolate linearly in
+// the table if it is used and covers h, else calculate them exactly.
+
+RopeFragPars::EffectivePars RopeFragPars::getEffectiveParameters(double h) {
+
+  // Interpolate in the table, within the interval containing h. Only the
+  // two nodes of the interval are calculated, if not done already.
+  if (doTable && h >= 1.0 && h < HTABLEMAX) {
+    double xNode = (h - 1.0) / DHTABLE;
+    int iNode = min( int(xNode), int(table.size()) - 2);
+    double f = max( 0., min( 1., xNode - iNode));
+    const EffectivePars& lo = tableNode(iNode);
+    const EffectivePars& hi = tableNode(iNode + 1);
+    EffectivePars p;
+    p.sigma         = lo.sigma + f * (hi.sigma - lo.sigma);
+    p.aLund         = lo.aLund + f * (hi.aLund - lo.aLund);
+    p.aExtraDiquark = lo.aExtraDiquark
+                    + f * (hi.aExtraDiquark - lo.aExtraDiquark);
+    p.bLund         = lo.bLund + f * (hi.bLund - lo.bLund);
+    p.probStoUD     = lo.probStoUD + f * (hi.probStoUD - lo.probStoUD);
+    p.probSQtoQQ    = lo.probSQtoQQ + f * (hi.probSQtoQQ - lo.probSQtoQQ);
+    p.probQQ1toQQ0  = lo.probQQ1toQQ0
+                    + f * (hi.probQQ1toQQ0 - lo.probQQ1toQQ0);
+    p.probQQtoQ     = lo.probQQtoQ + f * (hi.probQQtoQ - lo.probQQtoQ);
+    p.kappa         = lo.kappa + f * (hi.kappa - lo.kappa);
+    return p;
+  }
 
-  map<double, map<string, double> >::iterator parItr = parameters.find(h);
+  map<double, EffectivePars>::iterator parItr = parameters.find(h);
 
   // If the parameters are already calculated, return them.
   if ( parItr != parameters.end()) return parItr->second;
@@ -950,8 +1119,24 @@ map<string,double> RopeFragPars::getEffectiveParameters(double h) {
   if (!insertEffectiveParameters(h))
     loggerPtr->ERROR_MSG("inserting effective parameters");
 
-  // And recurse.
-  return getEffectiveParameters(h);
+  // And return them.
+  return parameters[h];
+
+}
+
+//--------------------------------------------------------------------------
+
+// Return a node of the table of parameters, calculated when first needed.
+
+const RopeFragPars::EffectivePars& RopeFragPars::tableNode(int iNode) {
+
+  if (!hasNode[iNode]) {
+    if (!calculateEffectiveParameters(1.0 + iNode * DHTABLE))
+      loggerPtr->ERROR_MSG("calculating effective parameters");
+    table[iNode]   = currentParameters();
+    hasNode[iNode] = true;
+  }
+  return table[iNode];
 
 }
 
@@ -1036,18 +1221,7 @@ bool RopeFragPars::calculateEffectiveParameters(double h) {
 
 bool RopeFragPars::insertEffectiveParameters(double h) {
 
-  map<string,double> p;
-  p["StringPT:sigma"]          = sigmaEff;
-  p["StringZ:bLund"]           = bEff;
-  p["StringFlav:probStoUD"]    = rhoEff;
-  p["StringFlav:probSQtoQQ"]   = xEff;
-  p["StringFlav:probQQ1toQQ0"] = yEff;
-  p["StringFlav:probQQtoQ"]    = xiEff;
-  p["StringZ:aLund"]           = aEff;
-  p["StringZ:aExtraDiquark"]   = adiqEff;
-  p["StringFlav:kappa"]        = kappaEff;
-
-  return (parameters.insert( make_pair(h,p)).second );
+  return (parameters.insert( make_pair(h, currentParameters())).second );
 
 }
 
@@ -1154,18 +1328,30 @@ bool FlavourRope::doChangeFragPar(StringFlav* flavPtr, StringZ* zPtr,
  StringPT * pTPtr, double m2Had, vector<int> iParton, int endId) {
 
   // The new parameters.
-  map<string, double> newPar;
-  if (doBuffon)
-    newPar = fetchParametersBuffon(m2Had, iParton, endId);
-  else
-    newPar = fetchParameters(m2Had, iParton, endId);
-  // Change settings to new settings.
-  for (map<string, double>::iterator itr = newPar.begin(); itr!=newPar.end();
-    ++itr) settingsPtr->parm( itr->first, itr->second);
-  // Re-initialize flavour, z, and pT selection with new settings.
-  flavPtr->init();
-  zPtr->init();
-  pTPtr->init();
+  RopeFragPars::EffectivePars newPar = doBuffon
+    ? fetchParametersBuffon(m2Had, iParton, endId)
+    : fetchParameters(m2Had, iParton, endId);
+  // Keep them within the ranges allowed for the corresponding settings,
+  // as for the default parameters.
+  double sigma = limited(sigmaPtr, newPar.sigma);
+  // Pass them directly to the flavour, z, and pT selection.
+  flavPtr->setEffectiveParameters(limited(probStoUDPtr, newPar.probStoUD),
+    limited(probSQtoQQPtr, newPar.probSQtoQQ),
+    limited(probQQ1toQQ0Ptr, newPar.probQQ1toQQ0),
+    limited(probQQtoQPtr, newPar.probQQtoQ), sigma);
+  // StringZ:deriveBLund is switched off once bLund has been derived at
+  // initialization. If it is still on, the derivation failed there, and
+  // bLund is derived from the effective aLund when StringZ is initialized
+  // from the settings, so that path is kept.
+  if (deriveBLundPtr != nullptr && deriveBLundPtr->valNow) {
+    settingsPtr->parm("StringZ:aLund", newPar.aLund);
+    settingsPtr->parm("StringZ:bLund", newPar.bLund);
+    settingsPtr->parm("StringZ:aExtraDiquark", newPar.aExtraDiquark);
+    zPtr->init();
+  } else zPtr->setEffectiveParameters(limited(aLundPtr, newPar.aLund),
+    limited(bLundPtr, newPar.bLund),
+    limited(aExtraDiquarkPtr, newPar.aExtraDiquark));
+  pTPtr->setEffectiveParameters(sigma);
   return true;
 
 }
@@ -1174,7 +1360,7 @@ bool FlavourRope::doChangeFragPar(StringFlav* flavPtr, StringZ* zPtr,
 
 // Find breakup placement and fetch effective parameters using Buffon.
 
-map<string, double> FlavourRope::fetchParametersBuffon(double m2Had,
+RopeFragPars::EffectivePars FlavourRope::fetchParametersBuffon(double m2Had,
   vector<int> iParton, int endId) {
   // If effective string tension is set manually, use that.
   if (fixedKappa) return fp.getEffectiveParameters(h);
@@ -1309,7 +1495,7 @@ map<string, double> FlavourRope::fetchParametersBuffon(double m2Had,
 //--------------------------------------------------------------------------
 // Find breakup placement and fetch effective parameters using Ropewalk.
 
-map<string, double> FlavourRope::fetchParameters(double m2Had,
+RopeFragPars::EffectivePars FlavourRope::fetchParameters(double m2Had,
   vector<int> iParton, int endId) {
   // If effective string tension is set manually, use that.
   if (fixedKappa) return fp.getEffectiveParameters(h);
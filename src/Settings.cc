@@ -7,6 +7,7 @@
 
 #include "Pythia8/Settings.h"
 #include "Pythia8/Plugins.h"
+#include "Pythia8/Snapshot.h"
 
 // Allow string and character manipulation.
 #include <cctype>
@@ -1050,6 +1051,168 @@ bool Settings::writeFileXML(ostream& os) {
 
 //--------------------------------------------------------------------------
 
+// Write the full database to a binary snapshot. Each map is stored as
+// its number of entries, followed by the key and all fields of each one.
+
+void Settings::writeSnapshot(SnapshotWriter& writer) const {
+
+  writer.put(int(flags.size()));
+  for (const auto& entry : flags) {
+    const Flag& flag = entry.second;
+    writer.put(entry.first); writer.put(flag.name);
+    writer.put(flag.valNow); writer.put(flag.valDefault);
+  }
+  writer.put(int(modes.size()));
+  for (const auto& entry : modes) {
+    const Mode& mode = entry.second;
+    writer.put(entry.first); writer.put(mode.name);
+    writer.put(mode.valNow); writer.put(mode.valDefault);
+    writer.put(mode.hasMin); writer.put(mode.hasMax);
+    writer.put(mode.valMin); writer.put(mode.valMax);
+    writer.put(mode.optOnly);
+  }
+  writer.put(int(parms.size()));
+  for (const auto& entry : parms) {
+    const Parm& parm = entry.second;
+    writer.put(entry.first); writer.put(parm.name);
+    writer.put(parm.valNow); writer.put(parm.valDefault);
+    writer.put(parm.hasMin); writer.put(parm.hasMax);
+    writer.put(parm.valMin); writer.put(parm.valMax);
+  }
+  writer.put(int(words.size()));
+  for (const auto& entry : words) {
+    const Word& word = entry.second;
+    writer.put(entry.first); writer.put(word.name);
+    writer.put(word.valNow); writer.put(word.valDefault);
+  }
+  writer.put(int(fvecs.size()));
+  for (const auto& entry : fvecs) {
+    const FVec& fvec = entry.second;
+    writer.put(entry.first); writer.put(fvec.name);
+    writer.put(fvec.valNow); writer.put(fvec.valDefault);
+  }
+  writer.put(int(mvecs.size()));
+  for (const auto& entry : mvecs) {
+    const MVec& mvec = entry.second;
+    writer.put(entry.first); writer.put(mvec.name);
+    writer.put(mvec.valNow); writer.put(mvec.valDefault);
+    writer.put(mvec.hasMin); writer.put(mvec.hasMax);
+    writer.put(mvec.valMin); writer.put(mvec.valMax);
+  }
+  writer.put(int(pvecs.size()));
+  for (const auto& entry : pvecs) {
+    const PVec& pvec = entry.second;
+    writer.put(entry.first); writer.put(pvec.name);
+    writer.put(pvec.valNow); writer.put(pvec.valDefault);
+    writer.put(pvec.hasMin); writer.put(pvec.hasMax);
+    writer.put(pvec.valMin); writer.put(pvec.valMax);
+  }
+  writer.put(int(wvecs.size()));
+  for (const auto& entry : wvecs) {
+    const WVec& wvec = entry.second;
+    writer.put(entry.first); writer.put(wvec.name);
+    writer.put(wvec.valNow); writer.put(wvec.valDefault);
+  }
+
+}
+
+//--------------------------------------------------------------------------
+
+// Replace the full database by the contents of a binary snapshot.
+// Entries are inserted at the end of each map, since they come sorted.
+
+bool Settings::readSnapshot(SnapshotReader& reader) {
+
+  // Reset the database.
+  flags.clear(); modes.clear(); parms.clear(); words.clear();
+  fvecs.clear(); mvecs.clear(); pvecs.clear(); wvecs.clear();
+  readStringHistory.clear(); readStringSubrun.clear();
+  isInit = false;
+  string key;
+  int n = 0;
+
+  // Read one map after the other.
+  if (!reader.get(n)) return false;
+  for (int i = 0; i < n; ++i) {
+    Flag flag;
+    if (!reader.get(key) || !reader.get(flag.name)
+      || !reader.get(flag.valNow) || !reader.get(flag.valDefault))
+      return false;
+    flags.emplace_hint(flags.end(), key, flag);
+  }
+  if (!reader.get(n)) return false;
+  for (int i = 0; i < n; ++i) {
+    Mode mode;
+    if (!reader.get(key) || !reader.get(mode.name)
+      || !reader.get(mode.valNow) || !reader.get(mode.valDefault)
+      || !reader.get(mode.hasMin) || !reader.get(mode.hasMax)
+      || !reader.get(mode.valMin) || !reader.get(mode.valMax)
+      || !reader.get(mode.optOnly)) return false;
+    modes.emplace_hint(modes.end(), key, mode);
+  }
+  if (!reader.get(n)) return false;
+  for (int i = 0; i < n; ++i) {
+    Parm parm;
+    if (!reader.get(key) || !reader.get(parm.name)
+      || !reader.get(parm.valNow) || !reader.get(parm.valDefault)
+      || !reader.get(parm.hasMin) || !reader.get(parm.hasMax)
+      || !reader.get(parm.valMin) || !reader.get(parm.valMax))
+      return false;
+    parms.emplace_hint(parms.end(), key, parm);
+  }
+  if (!reader.get(n)) return false;
+  for (int i = 0; i < n; ++i) {
+    Word word;
+    if (!reader.get(key) || !reader.get(word.name)
+      || !reader.get(word.valNow) || !reader.get(word.valDefault))
+      return false;
+    words.emplace_hint(words.end(), key, word);
+  }
+  if (!reader.get(n)) return false;
+  for (int i = 0; i < n; ++i) {
+    FVec fvec;
+    if (!reader.get(key) || !reader.get(fvec.name)
+      || !reader.get(fvec.valNow) || !reader.get(fvec.valDefault))
+      return false;
+    fvecs.emplace_hint(fvecs.end(), key, fvec);
+  }
+  if (!reader.get(n)) return false;
+  for (int i = 0; i < n; ++i) {
+    MVec mvec;
+    if (!reader.get(key) || !reader.get(mvec.name)
+      || !reader.get(mvec.valNow) || !reader.get(mvec.valDefault)
+      || !reader.get(mvec.hasMin) || !reader.get(mvec.hasMax)
+      || !reader.get(mvec.valMin) || !reader.get(mvec.valMax))
+      return false;
+    mvecs.emplace_hint(mvecs.end(), key, mvec);
+  }
+  if (!reader.get(n)) return false;
+  for (int i = 0; i < n; ++i) {
+    PVec pvec;
+    if (!reader.get(key) || !reader.get(pvec.name)
+      || !reader.get(pvec.valNow) || !reader.get(pvec.valDefault)
+      || !reader.get(pvec.hasMin) || !reader.get(pvec.hasMax)
+      || !reader.get(pvec.valMin) || !reader.get(pvec.valMax))
+      return false;
+    pvecs.emplace_hint(pvecs.end(), key, pvec);
+  }
+  if (!reader.get(n)) return false;
+  for (int i = 0; i < n; ++i) {
+    WVec wvec;
+    if (!reader.get(key) || !reader.get(wvec.name)
+      || !reader.get(wvec.valNow) || !reader.get(wvec.valDefault))
+      return false;
+    wvecs.emplace_hint(wvecs.end(), key, wvec);
+  }
+
+  // Done.
+  isInit = true;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
 // Print out table of database in lexigraphical order.
 
 void Settings::list(bool doListAll,  bool doListString, string match) {
@@ -1476,55 +1639,139 @@ void Settings::resetAll() {
 // Give back current value, with check that key exists.
 
 bool Settings::flag(string keyIn) {
-  if (isFlag(keyIn)) return flags[toLower(keyIn)].valNow;
+  string keyLower = toLower(keyIn);
+  if (countLookupsSave) ++lookupCountsSave[keyLower];
+  map<string, Flag>::iterator flagEntry = flags.find(keyLower);
+  if (flagEntry != flags.end()) return flagEntry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return false;
 }
 
 int Settings::mode(string keyIn) {
-  if (isMode(keyIn)) return modes[toLower(keyIn)].valNow;
+  string keyLower = toLower(keyIn);
+  if (countLookupsSave) ++lookupCountsSave[keyLower];
+  map<string, Mode>::iterator modeEntry = modes.find(keyLower);
+  if (modeEntry != modes.end()) return modeEntry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return 0;
 }
 
 double Settings::parm(string keyIn) {
-  if (isParm(keyIn)) return parms[toLower(keyIn)].valNow;
+  string keyLower = toLower(keyIn);
+  if (countLookupsSave) ++lookupCountsSave[keyLower];
+  map<string, Parm>::iterator parmEntry = parms.find(keyLower);
+  if (parmEntry != parms.end()) return parmEntry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return 0.;
 }
 
 string Settings::word(string keyIn) {
-  if (isWord(keyIn)) return words[toLower(keyIn)].valNow;
+  string keyLower = toLower(keyIn);
+  if (countLookupsSave) ++lookupCountsSave[keyLower];
+  map<string, Word>::iterator wordEntry = words.find(keyLower);
+  if (wordEntry != words.end()) return wordEntry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return " ";
 }
 
 vector<bool> Settings::fvec(string keyIn) {
-  if (isFVec(keyIn)) return fvecs[toLower(keyIn)].valNow;
+  string keyLower = toLower(keyIn);
+  if (countLookupsSave) ++lookupCountsSave[keyLower];
+  map<string, FVec>::iterator fvecEntry = fvecs.find(keyLower);
+  if (fvecEntry != fvecs.end()) return fvecEntry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return vector<bool>(1, false);
 }
 
 vector<int> Settings::mvec(string keyIn) {
-  if (isMVec(keyIn)) return mvecs[toLower(keyIn)].valNow;
+  string keyLower = toLower(keyIn);
+  if (countLookupsSave) ++lookupCountsSave[keyLower];
+  map<string, MVec>::iterator mvecEntry = mvecs.find(keyLower);
+  if (mvecEntry != mvecs.end()) return mvecEntry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return vector<int>(1, 0);
 }
 
 vector<double> Settings::pvec(string keyIn) {
-  if (isPVec(keyIn)) return pvecs[toLower(keyIn)].valNow;
+  string keyLower = toLower(keyIn);
+  if (countLookupsSave) ++lookupCountsSave[keyLower];
+  map<string, PVec>::iterator pvecEntry = pvecs.find(keyLower);
+  if (pvecEntry != pvecs.end()) return pvecEntry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return vector<double>(1, 0.);
 }
 
 vector<string> Settings::wvec(string keyIn) {
-  if (isWVec(keyIn)) return wvecs[toLower(keyIn)].valNow;
+  string keyLower = toLower(keyIn);
+  if (countLookupsSave) ++lookupCountsSave[keyLower];
+  map<string, WVec>::iterator wvecEntry = wvecs.find(keyLower);
+  if (wvecEntry != wvecs.end()) return wvecEntry->second.valNow;
   loggerPtr->ERROR_MSG("unknown key", keyIn);
   return vector<string>(1, " ");
 }
 
 //--------------------------------------------------------------------------
 
+// Give back pointer to entry, for repeated access without name lookup.
+
+const Flag* Settings::flagPtr(string keyIn) {
+  map<string, Flag>::iterator flagEntry = flags.find(toLower(keyIn));
+  if (flagEntry != flags.end()) return &flagEntry->second;
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return nullptr;
+}
+
+const Mode* Settings::modePtr(string keyIn) {
+  map<string, Mode>::iterator modeEntry = modes.find(toLower(keyIn));
+  if (modeEntry != modes.end()) return &modeEntry->second;
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return nullptr;
+}
+
+const Parm* Settings::parmPtr(string keyIn) {
+  map<string, Parm>::iterator parmEntry = parms.find(toLower(keyIn));
+  if (parmEntry != parms.end()) return &parmEntry->second;
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return nullptr;
+}
+
+const Word* Settings::wordPtr(string keyIn) {
+  map<string, Word>::iterator wordEntry = words.find(toLower(keyIn));
+  if (wordEntry != words.end()) return &wordEntry->second;
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return nullptr;
+}
+
+const FVec* Settings::fvecPtr(string keyIn) {
+  map<string, FVec>::iterator fvecEntry = fvecs.find(toLower(keyIn));
+  if (fvecEntry != fvecs.end()) return &fvecEntry->second;
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return nullptr;
+}
+
+const MVec* Settings::mvecPtr(string keyIn) {
+  map<string, MVec>::iterator mvecEntry = mvecs.find(toLower(keyIn));
+  if (mvecEntry != mvecs.end()) return &mvecEntry->second;
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return nullptr;
+}
+
+const PVec* Settings::pvecPtr(string keyIn) {
+  map<string, PVec>::iterator pvecEntry = pvecs.find(toLower(keyIn));
+  if (pvecEntry != pvecs.end()) return &pvecEntry->second;
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return nullptr;
+}
+
+const WVec* Settings::wvecPtr(string keyIn) {
+  map<string, WVec>::iterator wvecEntry = wvecs.find(toLower(keyIn));
+  if (wvecEntry != wvecs.end()) return &wvecEntry->second;
+  loggerPtr->ERROR_MSG("unknown key", keyIn);
+  return nullptr;
+}
+
+//--------------------------------------------------------------------------
+
 // Give back default value, with check that key exists.
 
 bool Settings::flagDefault(string keyIn) {
@@ -802,8 +802,8 @@ double SimpleSpaceShower::noEmissionProbability( double pTbegAll,
       if (minScale >= startingScale) break;
 
       // Get trial shower pT.
-      double pTtrial = pTnext( dipEnds, state, startingScale, minScale,
-        m2dip, idA, type, s, x);
+      double pTtrial = pTnextTrial( dipEnds, state, startingScale, minScale,
+        m2dip, s, x);
 
       // Done if evolution scale has fallen below minimum
       if ( pTtrial < minScale ) { wtnow *= 1.; break;}
@@ -851,6 +851,20 @@ double SimpleSpaceShower::pTnext( vector<SpaceDipoleEnd> dipEnds, Event event,
   double pTbegAll, double pTendAll, double m2dip, int, int, double s,
   double x) {
 
+  return pTnextTrial( dipEnds, event, pTbegAll, pTendAll, m2dip, s, x);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Select next pT for the stand-alone pTnext above, working directly on the
+// dipole ends and event, which are reset for each call. Used for the
+// repeated trials of noEmissionProbability.
+
+double SimpleSpaceShower::pTnextTrial( vector<SpaceDipoleEnd>& dipEnds,
+  Event& event, double pTbegAll, double pTendAll, double m2dip, double s,
+  double x) {
+
   double x1 = x;
   double x2 = m2dip/s/x1;
   int iSys = 0;
@@ -918,8 +932,13 @@ double SimpleSpaceShower::pTnext( vector<SpaceDipoleEnd> dipEnds, Event event,
 
   pdfMode = 0;
 
+  // The dipole ends belong to the caller and may go out of scope, so do
+  // not keep pointing to the selected one.
+  double pTsel = (dipEndSel == 0) ? 0. : sqrt(pT2sel);
+  dipEndSel    = 0;
+
   // Return nonvanishing value if found pT is bigger than already found.
-  return (dipEndSel == 0) ? 0. : sqrt(pT2sel);
+  return pTsel;
 
 }
 
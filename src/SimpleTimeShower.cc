@@ -111,6 +111,7 @@ void SimpleTimeShower::init( BeamParticle* beamAPtrIn,
   allowBeamRecoil    = flag("TimeShower:allowBeamRecoil");
   dampenBeamRecoil   = flag("TimeShower:dampenBeamRecoil");
   recoilDeadCone     = flag("TimeShower:recoilDeadCone");
+  reuseTrials        = flag("TimeShower:reuseTrials");
   recoilStrategyRF   = mode("TimeShower:recoilStrategyRF");
   allowMPIdipole     = flag("TimeShower:allowMPIdipole");
 
@@ -207,6 +208,12 @@ void SimpleTimeShower::init( BeamParticle* beamAPtrIn,
   doFSRinResonances  = flag("PartonLevel:FSRinResonances");
   resDecScaleChoice  = mode("TimeShower:resDecScalechoice");
 
+  // Starting scales of dipoles may be taken from LHEF input.
+  setScalesFromLHEFPtr
+    = settingsPtr->flagPtr("Beams:setProductionScalesFromLHEF");
+  setDipScalesFromLHEFPtr
+    = settingsPtr->flagPtr("Beams:setDipoleShowerStartingScalesFromLHEF");
+
   // Parameters of onium evolution.
   oniumEmissions.clear();
   SplitOniaSetup charmonium(infoPtr, &alphaS, 4);
@@ -226,6 +233,7 @@ void SimpleTimeShower::init( BeamParticle* beamAPtrIn,
   nMaxGlobalBranch   = mode("TimeShower:nMaxGlobalBranch");
   // Number of partons in Born-like events, to distinguish between S and H.
   nFinalBorn         = mode("TimeShower:nPartonsInBorn");
+  nPartonsInBornPtr  = settingsPtr->modePtr("TimeShower:nPartonsInBorn");
   // Flag to allow to start from a scale smaller than scalup.
   globalRecoilMode   = mode("TimeShower:globalRecoilMode");
   // Flag to allow to start from a scale smaller than scalup.
@@ -685,7 +693,7 @@ void SimpleTimeShower::prepareGlobal( Event& event) {
   nHard      = 0;
   nProposed.clear();
   hardPartons.resize(0);
-  nFinalBorn = mode("TimeShower:nPartonsInBorn");
+  nFinalBorn = nPartonsInBornPtr->valNow;
 
   // Global recoils: store positions of hard outgoing partons.
   // No global recoil for H events.
@@ -1538,13 +1546,12 @@ void SimpleTimeShower::setupQCDdip( int iSys, int i, int colTag, int colSign,
 
     // If requested, force maximal pT to LHEF input value.
     if ( abs(event[iRad].status()) > 20 &&  abs(event[iRad].status()) < 24
-      && ( settingsPtr->flag("Beams:setProductionScalesFromLHEF")
-        || settingsPtr->flag("Beams:setDipoleShowerStartingScalesFromLHEF") )
+      && ( setScalesFromLHEFPtr->valNow || setDipScalesFromLHEFPtr->valNow )
       && event[iRad].scale() > 0.) {
       double scaleNow = event[iRad].scale();
       // If the LHEF contains dipole starting scales, extract the relevant
       // scales from info.
-      if (settingsPtr->flag("Beams:setDipoleShowerStartingScalesFromLHEF") ) {
+      if (setDipScalesFromLHEFPtr->valNow) {
         string name="scalup_";
         ostringstream oss; oss.str("");
         oss << iRad-2 << "_" << iRec-2;
@@ -2191,6 +2198,18 @@ double SimpleTimeShower::pTnext( Event& event, double pTbegAll,
   weightContainerPtr->weightsSimpleShower.setEnhancedTrial(0., 1.);
   if (doOniumShower) regenerateOniumDipoles(event);
 
+  // Trial emissions of QCD dipole ends can be reused in later steps,
+  // unless their generation also involves weights or enhancements.
+  // Stored trials are only used if the previously selected emission was
+  // performed, since an interleaved MPI or ISR step that won over it
+  // does not leave the remaining trials unbiased.
+  bool reuseTrialsNow = reuseTrials && !doTrialNow && !canEnhanceET
+    && !doUncertainties && !doOniumShower && !skipFirstMECinHardProc
+    && skipFirstMECinResDecIDs.empty();
+  bool useTrialsNow = reuseTrialsNow && selBranched;
+  selBranched = false;
+  dipNoTrial.clear();
+
   for (int iDip = 0; iDip < int(dipEnd.size()); ++iDip) {
     TimeDipoleEnd& dip = dipEnd[iDip];
     dip.pAccept        = 1.0;
@@ -2287,18 +2306,39 @@ double SimpleTimeShower::pTnext( Event& event, double pTbegAll,
     }
 
     // Do not try splitting if the corrected dipole mass is negative.
-    dip.pT2 = 0.;
     if (dip.m2DipCorr < 0.) {
+      dip.pT2      = 0.;
+      dip.hasTrial = false;
       loggerPtr->WARNING_MSG("negative dipole mass");
       continue;
     }
 
+    // Reuse the trial emission of an unchanged QCD dipole end, which is
+    // still valid below the new starting scale since the evolution is
+    // memoryless. If none was found, the stored range is checked below.
+    bool canReuse = reuseTrialsNow && useLocalRecoilNow && dip.colType != 0
+      && dip.oniumType == 0 && dip.isrType == 0;
+    if (canReuse && useTrialsNow && dip.hasValidTrial(pT2begDip)) {
+      if (dip.pT2 == 0.) dipNoTrial.push_back( make_pair(iDip, pT2begDip) );
+      else if (dip.pT2 > pT2sel) {
+        pT2sel  = dip.pT2;
+        dipSel  = &dip;
+        iDipSel = iDip;
+        splittingNameSel = dip.splittingNameTrial;
+      }
+      continue;
+    }
+    dip.pT2      = 0.;
+    dip.hasTrial = false;
+
     // Do QCD, QED, weak, onia or HV evolution if it makes sense.
     if (pT2begDip > pT2sel) {
       if (dip.oniumType != 0 && !oniumEmissions.empty())
         pT2nextOnium(pT2begDip, pT2sel, dip, event);
-      else if (dip.colType != 0)
+      else if (dip.colType != 0) {
         pT2nextQCD(pT2begDip, pT2sel, dip, event);
+        if (canReuse) dip.saveTrial(pT2begDip, pT2sel, splittingNameNow);
+      }
       else if (dip.chgType != 0 || dip.gamType != 0)
         pT2nextQED(pT2begDip, pT2sel, dip, event);
       else if (dip.weakType != 0)
@@ -2316,6 +2356,27 @@ double SimpleTimeShower::pTnext( Event& event, double pTbegAll,
     }
   }
 
+  // Dipole ends without a trial emission above the lower end of their
+  // stored range must be evolved further if that range does not reach
+  // down to the currently selected emission.
+  for (int iNo = 0; iNo < int(dipNoTrial.size()); ++iNo) {
+    TimeDipoleEnd& dip = dipEnd[dipNoTrial[iNo].first];
+    double pT2begDip   = min(dipNoTrial[iNo].second, dip.pT2TrialEnd);
+    if (pT2begDip <= pT2sel) continue;
+    useLocalRecoilNow  = true;
+    pT2nextQCD(pT2begDip, pT2sel, dip, event);
+    dip.saveTrial(dipNoTrial[iNo].second, pT2sel, splittingNameNow);
+    if (dip.pT2 > pT2sel) {
+      pT2sel  = dip.pT2;
+      dipSel  = &dip;
+      iDipSel = dipNoTrial[iNo].first;
+      splittingNameSel = splittingNameNow;
+    }
+  }
+
+  // The trial emission of the selected dipole end is used up.
+  if (dipSel != 0) dipSel->hasTrial = false;
+
   // Update the number of proposed timelike emissions.
   if (dipSel != 0 && nProposed.find(dipSel->system) != nProposed.end())
     ++nProposed[dipSel->system];
@@ -2471,8 +2532,8 @@ double SimpleTimeShower::noEmissionProbability( double pTbegAll,
       if (minScale >= startingScale) break;
 
       // Get trial shower pT.
-      double pTtrial = pTnext( dipEnds, state, startingScale, minScale, m2dip,
-        idA, type, s, x);
+      double pTtrial = pTnextTrial( dipEnds, state, startingScale,
+        minScale);
 
       // Done if evolution scale has fallen below minimum
       if ( pTtrial < minScale ) { wtnow *= 1.; break;}
@@ -2520,6 +2581,19 @@ double SimpleTimeShower::noEmissionProbability( double pTbegAll,
 double SimpleTimeShower::pTnext( vector<TimeDipoleEnd> dipEnds, Event event,
   double pTbegAll, double pTendAll, double, int, int, double, double) {
 
+  return pTnextTrial( dipEnds, event, pTbegAll, pTendAll);
+
+}
+
+//--------------------------------------------------------------------------
+
+// Select next pT for the stand-alone pTnext above, working directly on the
+// dipole ends and event, which are reset for each call. Used for the
+// repeated trials of noEmissionProbability.
+
+double SimpleTimeShower::pTnextTrial( vector<TimeDipoleEnd>& dipEnds,
+  Event& event, double pTbegAll, double pTendAll) {
+
   // Starting values: no radiating dipole found.
   double pT2sel = pow2(pTendAll);
   iDipSel       = 0;
@@ -2578,8 +2652,13 @@ double SimpleTimeShower::pTnext( vector<TimeDipoleEnd> dipEnds, Event event,
 
   pdfMode = 0;
 
+  // The dipole ends belong to the caller and may go out of scope, so do
+  // not keep pointing to the selected one.
+  double pTsel = (dipSel == 0) ? 0. : sqrt(pT2sel);
+  dipSel       = 0;
+
   // Return nonvanishing value if found pT is bigger than already found.
-  return (dipSel == 0) ? 0. : sqrt(pT2sel);
+  return pTsel;
 
 }
 
@@ -3680,6 +3759,9 @@ void SimpleTimeShower::pT2nextOnium(double pT2begDip, double pT2sel,
 
 bool SimpleTimeShower::branch( Event& event, bool isInterleaved) {
 
+  // The remaining trial emissions can be reused in the next step.
+  selBranched = true;
+
   // Check if this system is part of the hard scattering
   // (including resonance decay products).
   bool hardSystem = partonSystemsPtr->getHard(dipSel->system);
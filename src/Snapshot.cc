@@ -0,0 +1,179 @@
+// Snapshot.cc is a part of the PYTHIA event generator.
+// Copyright (C) 2024 Torbjorn Sjostrand.
+// PYTHIA is licenced under the GNU GPL v2 or later, see COPYING for details.
+// Please respect the MCnet Guidelines, see GUIDELINES for details.
+
+// Function definitions (not found in the header) for the Snapshot class.
+
+#include "Pythia8/Snapshot.h"
+#include "Pythia8/ParticleData.h"
+#include "Pythia8/Settings.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Pythia8 {
+
+//==========================================================================
+
+// The Snapshot class.
+
+// The file starts with a header of HEADERSIZE bytes: the MAGIC string,
+// the format VERSION, the BYTEORDER check value, the size of the contents
+// that follow and their checksum. The contents are the Settings database
+// followed by the ParticleData one, as written by their writeSnapshot
+// methods. The format VERSION must be increased whenever these change.
+
+//--------------------------------------------------------------------------
+
+// Constants: could be changed here if desired, but normally should not.
+// These are of technical nature, as described for each.
+
+// Identification of a snapshot file.
+const char     Snapshot::MAGIC[8]   = {'P', 'Y', '8', 'S', 'N', 'A', 'P', ' '};
+
+// Format version, and value to check that the byte order agrees.
+const uint32_t Snapshot::VERSION    = 1;
+const uint32_t Snapshot::BYTEORDER  = 0x01020304;
+
+// Size of the header.
+const size_t   Snapshot::HEADERSIZE = 32;
+
+//--------------------------------------------------------------------------
+
+// Open and verify a snapshot file, by mapping it into memory.
+
+bool Snapshot::open(string fileName) {
+
+  // Release any previous file.
+  close();
+
+  // Map the file into memory.
+  int fd = ::open(fileName.c_str(), O_RDONLY);
+  struct stat fileStat;
+  if (fd < 0 || fstat(fd, &fileStat) != 0
+    || size_t(fileStat.st_size) < HEADERSIZE) {
+    if (fd >= 0) ::close(fd);
+    if (loggerPtr) loggerPtr->ERROR_MSG("could not map file", fileName);
+    return false;
+  }
+  size_t sizeNow = fileStat.st_size;
+  void* mapPtr = mmap(nullptr, sizeNow, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapPtr == MAP_FAILED) {
+    if (loggerPtr) loggerPtr->ERROR_MSG("could not map file", fileName);
+    return false;
+  }
+  const char* ptrNow = static_cast<const char*>(mapPtr);
+
+  // Check the header and the checksum of the contents.
+  uint32_t headerIn[2];
+  uint64_t sizeIn, sumIn;
+  memcpy(headerIn, ptrNow + 8, sizeof(headerIn));
+  memcpy(&sizeIn, ptrNow + 16, sizeof(sizeIn));
+  memcpy(&sumIn, ptrNow + 24, sizeof(sumIn));
+  if (memcmp(ptrNow, MAGIC, 8) != 0 || headerIn[0] != VERSION
+    || headerIn[1] != BYTEORDER || sizeIn != sizeNow - HEADERSIZE
+    || sumIn != checksum(ptrNow + HEADERSIZE, sizeIn)) {
+    munmap(mapPtr, sizeNow);
+    if (loggerPtr) loggerPtr->ERROR_MSG("not a valid snapshot file",
+      fileName);
+    return false;
+  }
+
+  // Done.
+  dataPtr  = ptrNow;
+  dataSize = sizeNow;
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Release the file.
+
+void Snapshot::close() {
+
+  if (dataPtr) munmap(const_cast<char*>(dataPtr), dataSize);
+  dataPtr  = nullptr;
+  dataSize = 0;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Fill the databases from the snapshot.
+
+bool Snapshot::load(Settings& settings, ParticleData& particleData) const {
+
+  if (!isOpen()) {
+    if (loggerPtr) loggerPtr->ERROR_MSG("no snapshot file is open");
+    return false;
+  }
+  SnapshotReader reader(dataPtr + HEADERSIZE, dataPtr + dataSize);
+  if (!settings.readSnapshot(reader) || !particleData.readSnapshot(reader)
+    || !reader.atEnd()) {
+    if (loggerPtr) loggerPtr->ERROR_MSG("inconsistent snapshot contents");
+    return false;
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Write a snapshot of the databases to file.
+
+bool Snapshot::write(string fileName, const Settings& settings,
+  const ParticleData& particleData, Logger* loggerPtrIn) {
+
+  // Collect the contents.
+  SnapshotWriter writer;
+  settings.writeSnapshot(writer);
+  particleData.writeSnapshot(writer);
+  const string& contents = writer.data();
+
+  // Form the header.
+  char header[HEADERSIZE];
+  uint32_t headerOut[2] = {VERSION, BYTEORDER};
+  uint64_t sizeOut = contents.size();
+  uint64_t sumOut  = checksum(contents.data(), contents.size());
+  memcpy(header, MAGIC, 8);
+  memcpy(header + 8, headerOut, sizeof(headerOut));
+  memcpy(header + 16, &sizeOut, sizeof(sizeOut));
+  memcpy(header + 24, &sumOut, sizeof(sumOut));
+
+  // Write the file.
+  ofstream os(fileName.c_str(), ios::out | ios::binary | ios::trunc);
+  if (os.good()) {
+    os.write(header, HEADERSIZE);
+    os.write(contents.data(), contents.size());
+  }
+  if (!os.good()) {
+    if (loggerPtrIn) loggerPtrIn->ERROR_MSG("could not write file",
+      fileName);
+    return false;
+  }
+  return true;
+
+}
+
+//--------------------------------------------------------------------------
+
+// Checksum of the contents, using the 64-bit FNV-1a hash.
+
+uint64_t Snapshot::checksum(const char* begIn, size_t nIn) {
+
+  uint64_t sum = 0xcbf29ce484222325ULL;
+  for (size_t i = 0; i < nIn; ++i) {
+    sum ^= static_cast<unsigned char>(begIn[i]);
+    sum *= 0x100000001b3ULL;
+  }
+  return sum;
+
+}
+
+//==========================================================================
+
+} // end namespace Pythia8
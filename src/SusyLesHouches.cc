@@ -130,6 +130,9 @@ int SusyLesHouches::readFile(istream& is, int verboseIn,
       line.erase(line.find("#"),line.length()-line.find("#")-1);
     }
 
+    // Keep the line, to identify the spectrum read in.
+    contentsSav += line + "\n";
+
     // Remove blanks before and after an = sign. Also remove multiple blanks
     while (line.find(" =") != string::npos) line.erase( line.find(" ="), 1);
     while (line.find("= ") != string::npos) line.erase( line.find("= ")+1, 1);